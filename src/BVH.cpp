@@ -0,0 +1,141 @@
+#include "BVH.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace Eigen;
+
+namespace btc
+{
+	// Primitives per leaf
+	static const int LEAF_SIZE = 4;
+
+	BVH::BVH() :
+		nprims(0)
+	{
+
+	}
+
+	void BVH::build(const MatrixXd &aabbs)
+	{
+		nprims = aabbs.cols();
+		boxes = aabbs;
+		nodes.clear();
+		prims.resize(nprims);
+		for (int i = 0; i < nprims; i++) prims[i] = i;
+		if (nprims == 0) return;
+		nodes.reserve(2 * (nprims / LEAF_SIZE + 1));
+		buildNode(aabbs, 0, nprims);
+	}
+
+	int BVH::buildNode(const MatrixXd &aabbs, int first, int count)
+	{
+		int n = nodes.size();
+		nodes.push_back(Node());
+		Vector3d lo = aabbs.block<3, 1>(0, prims[first]);
+		Vector3d hi = aabbs.block<3, 1>(3, prims[first]);
+		Vector3d clo = 0.5*(lo + hi);
+		Vector3d chi = clo;
+		for (int k = first + 1; k < first + count; k++) {
+			int p = prims[k];
+			Vector3d c = 0.5*(aabbs.block<3, 1>(0, p) + aabbs.block<3, 1>(3, p));
+			lo = lo.cwiseMin(aabbs.block<3, 1>(0, p));
+			hi = hi.cwiseMax(aabbs.block<3, 1>(3, p));
+			clo = clo.cwiseMin(c);
+			chi = chi.cwiseMax(c);
+		}
+		for (int i = 0; i < 3; i++) {
+			nodes[n].box[i] = lo(i);
+			nodes[n].box[i + 3] = hi(i);
+		}
+
+		if (count <= LEAF_SIZE) {
+			nodes[n].right = -1;
+			nodes[n].first = first;
+			nodes[n].count = count;
+			return n;
+		}
+
+		// Median split of the centers along their longest axis
+		int axis;
+		(chi - clo).maxCoeff(&axis);
+		int mid = first + count / 2;
+		nth_element(prims.begin() + first, prims.begin() + mid, prims.begin() + first + count, [&](int a, int b) {
+			return aabbs(axis, a) + aabbs(axis + 3, a) < aabbs(axis, b) + aabbs(axis + 3, b);
+		});
+
+		buildNode(aabbs, first, mid - first);
+		int right = buildNode(aabbs, mid, first + count - mid);
+		nodes[n].right = right;
+		nodes[n].first = -1;
+		nodes[n].count = 0;
+		return n;
+	}
+
+	void BVH::refit(const MatrixXd &aabbs)
+	{
+		boxes = aabbs;
+		// Children come after their parents, so a reverse sweep sees every child before its parent
+		for (int n = nodes.size() - 1; n >= 0; n--) {
+			Node &node = nodes[n];
+			if (node.count > 0) {
+				for (int i = 0; i < 3; i++) {
+					node.box[i] = aabbs(i, prims[node.first]);
+					node.box[i + 3] = aabbs(i + 3, prims[node.first]);
+				}
+				for (int k = node.first + 1; k < node.first + node.count; k++) {
+					for (int i = 0; i < 3; i++) {
+						node.box[i] = min(node.box[i], aabbs(i, prims[k]));
+						node.box[i + 3] = max(node.box[i + 3], aabbs(i + 3, prims[k]));
+					}
+				}
+			}
+			else {
+				const Node &l = nodes[n + 1];
+				const Node &r = nodes[node.right];
+				for (int i = 0; i < 3; i++) {
+					node.box[i] = min(l.box[i], r.box[i]);
+					node.box[i + 3] = max(l.box[i + 3], r.box[i + 3]);
+				}
+			}
+		}
+	}
+
+	void BVH::query(const Vector3d &lo, const Vector3d &hi, double pad, vector<int> &hits) const
+	{
+		if (nodes.empty()) return;
+		Vector3d qlo = lo - Vector3d::Constant(pad);
+		Vector3d qhi = hi + Vector3d::Constant(pad);
+		size_t start = hits.size();
+
+		int stack[64];
+		int top = 0;
+		stack[top++] = 0;
+		while (top > 0) {
+			int n = stack[--top];
+			const Node &node = nodes[n];
+			if (node.box[0] > qhi(0) || node.box[3] < qlo(0) ||
+				node.box[1] > qhi(1) || node.box[4] < qlo(1) ||
+				node.box[2] > qhi(2) || node.box[5] < qlo(2)) {
+				continue;
+			}
+			if (node.count > 0) {
+				for (int k = node.first; k < node.first + node.count; k++) {
+					int p = prims[k];
+					if (boxes(0, p) > qhi(0) || boxes(3, p) < qlo(0) ||
+						boxes(1, p) > qhi(1) || boxes(4, p) < qlo(1) ||
+						boxes(2, p) > qhi(2) || boxes(5, p) < qlo(2)) {
+						continue;
+					}
+					hits.push_back(p);
+				}
+			}
+			else {
+				stack[top++] = node.right;
+				stack[top++] = n + 1;
+			}
+		}
+
+		sort(hits.begin() + start, hits.end());
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+#ifndef __BVH__
+#define __BVH__
+
+#include <vector>
+
+#define EIGEN_DONT_ALIGN_STATICALLY
+#include <Eigen/Dense>
+
+namespace btc
+{
+	// Bounding volume hierarchy over a fixed set of primitive AABBs
+	// The boxes are given as a 6xn matrix with the min corner in the top 3 rows, the same layout as the AABBs in boxTriCollision
+	// build() is only needed when the primitives change, refit() updates the node boxes after the primitives move
+	class BVH
+	{
+	public:
+		BVH();
+		virtual ~BVH() {}
+
+		void build(const Eigen::MatrixXd &aabbs);
+		// The number of primitives must match the last build
+		void refit(const Eigen::MatrixXd &aabbs);
+
+		int size() const { return nprims; }
+
+		// Appends the primitives whose box overlaps [lo - pad, hi + pad], in increasing index order
+		void query(const Eigen::Vector3d &lo, const Eigen::Vector3d &hi, double pad, std::vector<int> &hits) const;
+
+	private:
+		struct Node
+		{
+			double box[6];
+			int right; // The left child always directly follows its parent
+			int first; // Primitive range of a leaf in prims
+			int count; // Zero for an inner node
+		};
+
+		int nprims;
+		Eigen::MatrixXd boxes; // Primitive boxes from the last build or refit
+		std::vector<Node> nodes; // Parents come before their children
+		std::vector<int> prims;
+
+		int buildNode(const Eigen::MatrixXd &aabbs, int first, int count);
+	};
+}
+
+#endif
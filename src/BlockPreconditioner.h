@@ -0,0 +1,157 @@
+#pragma once
+#ifndef __BlockPreconditioner__
+#define __BlockPreconditioner__
+
+#include <vector>
+
+#define EIGEN_DONT_ALIGN_STATICALLY
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+class BlockSystem;
+
+// Block-Jacobi preconditioner for Eigen's iterative solvers
+// The variables are split into small consecutive blocks, 3x3 for a node's Lagrangian velocity and 2x2 for an EoL node's Eulerian velocity,
+// and each diagonal block of the matrix is inverted on its own
+// Blocks are given by their start indices with a final entry equal to the size, without any the preconditioner is plain diagonal
+class BlockJacobiPreconditioner
+{
+	typedef Eigen::Matrix<double, Eigen::Dynamic, 1> Vector;
+public:
+	typedef double Scalar;
+	typedef Vector::StorageIndex StorageIndex;
+	enum {
+		ColsAtCompileTime = Eigen::Dynamic,
+		MaxColsAtCompileTime = Eigen::Dynamic
+	};
+
+	BlockJacobiPreconditioner() : n(0), initialized(false) {}
+
+	template<typename MatType>
+	explicit BlockJacobiPreconditioner(const MatType& mat) : n(0), initialized(false)
+	{
+		compute(mat);
+	}
+
+	// Lagrangian variables come first in 3x3 node blocks, everything after lagrangian is in 2x2 blocks
+	static std::vector<int> nodeBlocks(int size, int lagrangian)
+	{
+		std::vector<int> starts;
+		starts.reserve(size / 2 + 2);
+		for (int i = 0; i < lagrangian; i += 3) starts.push_back(i);
+		for (int i = lagrangian; i < size; i += 2) starts.push_back(i);
+		starts.push_back(size);
+		return starts;
+	}
+
+	void setBlocks(const std::vector<int>& starts) { blockStart = starts; }
+	const std::vector<int>& blocks() const { return blockStart; }
+
+	Eigen::Index rows() const { return n; }
+	Eigen::Index cols() const { return n; }
+
+	template<typename MatType>
+	BlockJacobiPreconditioner& analyzePattern(const MatType&)
+	{
+		return *this;
+	}
+
+	template<typename MatType>
+	BlockJacobiPreconditioner& factorize(const MatType& mat)
+	{
+		// Scatter the matrix entries that land inside their own block
+		std::vector<int> blockOf;
+		setup(mat.cols(), blockOf);
+		for (int j = 0; j < mat.outerSize(); j++) {
+			int b = blockOf[j];
+			for (typename MatType::InnerIterator it(mat, j); it; ++it) {
+				if (blockOf[it.index()] == b) {
+					inv[b](it.index() - blockStart[b], j - blockStart[b]) = it.value();
+				}
+			}
+		}
+		invert();
+		return *this;
+	}
+
+	// The diagonal blocks of a matrix free system come straight from its node blocks, see BlockSystem.cpp
+	BlockJacobiPreconditioner& factorize(const BlockSystem& mat);
+
+	template<typename MatType>
+	BlockJacobiPreconditioner& compute(const MatType& mat)
+	{
+		return factorize(mat);
+	}
+
+	template<typename Rhs>
+	Vector solve(const Rhs& b) const
+	{
+		eigen_assert(initialized && "BlockJacobiPreconditioner is not initialized.");
+		Vector x(n);
+		int nblocks = blockStart.size() - 1;
+		for (int k = 0; k < nblocks; k++) {
+			int i = blockStart[k];
+			int s = blockStart[k + 1] - i;
+			if (s == 3) x.segment<3>(i) = inv[k] * b.template segment<3>(i);
+			else if (s == 2) x.segment<2>(i) = inv[k].topLeftCorner<2, 2>() * b.template segment<2>(i);
+			else x(i) = inv[k](0, 0) * b(i);
+		}
+		return x;
+	}
+
+	Eigen::ComputationInfo info() { return Eigen::Success; }
+
+private:
+	Eigen::Index n;
+	bool initialized;
+	std::vector<int> blockStart;
+	std::vector<Eigen::Matrix3d> inv;
+
+	// Sizes the blocks for an n x n matrix, with zeroed blocks and the variable to block lookup
+	void setup(int size, std::vector<int>& blockOf)
+	{
+		n = size;
+		if (blockStart.empty() || blockStart.back() != n) {
+			blockStart.resize(n + 1);
+			for (int i = 0; i <= n; i++) blockStart[i] = i;
+		}
+		blockOf.resize(n);
+		int nblocks = blockStart.size() - 1;
+		for (int b = 0; b < nblocks; b++) {
+			for (int i = blockStart[b]; i < blockStart[b + 1]; i++) blockOf[i] = b;
+		}
+		inv.assign(nblocks, Eigen::Matrix3d::Zero());
+	}
+
+	void invert()
+	{
+		// Fall back to the diagonal for a singular block, and to the identity for a zero diagonal
+		int nblocks = blockStart.size() - 1;
+		for (int b = 0; b < nblocks; b++) {
+			int s = blockStart[b + 1] - blockStart[b];
+			Eigen::Matrix3d& B = inv[b];
+			bool ok = false;
+			if (s == 3) {
+				Eigen::Matrix3d Binv;
+				double det;
+				B.computeInverseAndDetWithCheck(Binv, det, ok, 1e-300);
+				if (ok) B = Binv;
+			}
+			else if (s == 2) {
+				Eigen::Matrix2d Binv;
+				double det;
+				Eigen::Matrix2d B2 = B.topLeftCorner<2, 2>();
+				B2.computeInverseAndDetWithCheck(Binv, det, ok, 1e-300);
+				if (ok) B.topLeftCorner<2, 2>() = Binv;
+			}
+			if (!ok) {
+				Eigen::Vector3d d = B.diagonal();
+				B.setZero();
+				for (int i = 0; i < s; i++) B(i, i) = d(i) != 0.0 ? 1.0 / d(i) : 1.0;
+			}
+		}
+		initialized = true;
+	}
+};
+
+#endif
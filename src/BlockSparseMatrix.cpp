@@ -0,0 +1,110 @@
+#include "BlockSparseMatrix.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace Eigen;
+
+typedef Matrix<double, 3, 3, RowMajor> Matrix3dR;
+
+BlockSparseMatrix::BlockSparseMatrix() :
+	start(1, 0),
+	lagrangian(0),
+	rowPtr(1, 0)
+{
+
+}
+
+bool BlockSparseMatrix::setLayout(int lagrangian, int size)
+{
+	if (this->lagrangian == lagrangian && start.back() == size) return false;
+
+	this->lagrangian = lagrangian;
+	start.clear();
+	for (int i = 0; i < lagrangian; i += 3) start.push_back(i);
+	for (int i = lagrangian; i < size; i += 2) start.push_back(i);
+	start.push_back(size);
+
+	rowPtr.assign(start.size(), 0);
+	colIdx.clear();
+	values.clear();
+	return true;
+}
+
+void BlockSparseMatrix::setPattern(const vector<BlockEntry>& entries, vector<int>& map)
+{
+	long long nb = blockRows();
+	vector<long long> keys(entries.size());
+	for (size_t i = 0; i < entries.size(); i++) {
+		keys[i] = blockOf(entries[i].row) * nb + blockOf(entries[i].col);
+	}
+	vector<long long> sorted = keys;
+	sort(sorted.begin(), sorted.end());
+	sorted.erase(unique(sorted.begin(), sorted.end()), sorted.end());
+
+	rowPtr.assign(nb + 1, 0);
+	colIdx.resize(sorted.size());
+	for (size_t k = 0; k < sorted.size(); k++) {
+		colIdx[k] = sorted[k] % nb;
+		rowPtr[sorted[k] / nb + 1]++;
+	}
+	for (int r = 0; r < nb; r++) rowPtr[r + 1] += rowPtr[r];
+
+	map.resize(entries.size());
+	for (size_t i = 0; i < entries.size(); i++) {
+		map[i] = lower_bound(sorted.begin(), sorted.end(), keys[i]) - sorted.begin();
+	}
+
+	values.assign(9 * sorted.size(), 0.0);
+}
+
+void BlockSparseMatrix::setZero()
+{
+	fill(values.begin(), values.end(), 0.0);
+}
+
+size_t BlockSparseMatrix::scatter(const vector<BlockEntry>& entries, const vector<int>& map, size_t k)
+{
+	// The padding of the entries is zero, so whole 3x3 blocks can be added
+	for (size_t i = 0; i < entries.size(); i++, k++) {
+		Map<Matrix3dR>(&values[9 * map[k]]) += Map<const Matrix3dR>(entries[i].v);
+	}
+	return k;
+}
+
+void BlockSparseMatrix::multiply(const VectorXd& x, VectorXd& y) const
+{
+	int nb = blockRows();
+	y.setZero(rows());
+	for (int r = 0; r < nb; r++) {
+		int rs = blockSize(r);
+		for (int k = rowPtr[r]; k < rowPtr[r + 1]; k++) {
+			int c = colIdx[k];
+			int cs = blockSize(c);
+			Map<const Matrix3dR> B(&values[9 * k]);
+			if (rs == 3 && cs == 3) {
+				y.segment<3>(start[r]) += B * x.segment<3>(start[c]);
+			}
+			else {
+				y.segment(start[r], rs) += B.topLeftCorner(rs, cs) * x.segment(start[c], cs);
+			}
+		}
+	}
+}
+
+VectorXd BlockSparseMatrix::operator*(const VectorXd& x) const
+{
+	VectorXd y;
+	multiply(x, y);
+	return y;
+}
+
+SparseMatrix<double> BlockSparseMatrix::toSparse() const
+{
+	vector<Triplet<double> > a_;
+	a_.reserve(9 * colIdx.size());
+	forEach([&](int i, int j, double v) { a_.push_back(Triplet<double>(i, j, v)); });
+	SparseMatrix<double> A(rows(), cols());
+	A.setFromTriplets(a_.begin(), a_.end());
+	return A;
+}
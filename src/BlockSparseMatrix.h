@@ -0,0 +1,82 @@
+#pragma once
+#ifndef __BlockSparseMatrix__
+#define __BlockSparseMatrix__
+
+#include <vector>
+
+#define EIGEN_DONT_ALIGN_STATICALLY
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+// One dense block added into a BlockSparseMatrix, at the variable offsets of its first row and column
+// The values are row major with a stride of 3, anything outside the block's own rows x cols must be zero
+struct BlockEntry {
+	int row, col;
+	double v[9];
+};
+
+// Square block compressed row matrix for the cloth system
+// Rows and columns are split into 3 variable blocks for the Lagrangian velocity of every node,
+// followed by 2 variable blocks for the Eulerian velocity of every EoL node
+// Each stored block is kept as a padded 3x3 so every block has the same layout
+class BlockSparseMatrix
+{
+public:
+	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+	BlockSparseMatrix();
+	virtual ~BlockSparseMatrix() {}
+
+	// The first lagrangian variables are in 3 variable blocks, the rest up to size in 2 variable blocks
+	// Clears the pattern and returns true when the layout changes
+	bool setLayout(int lagrangian, int size);
+
+	int rows() const { return start.back(); }
+	int cols() const { return start.back(); }
+	int blockRows() const { return start.size() - 1; }
+	int nonZeroBlocks() const { return colIdx.size(); }
+
+	// Builds the pattern holding every entry, map gets the slot each entry is added into
+	void setPattern(const std::vector<BlockEntry>& entries, std::vector<int>& map);
+
+	void setZero();
+	// Adds the entries into their slots from setPattern, k is the position of entries[0] in that map
+	// Returns the position after the last entry
+	size_t scatter(const std::vector<BlockEntry>& entries, const std::vector<int>& map, size_t k);
+
+	// y = A*x
+	void multiply(const Eigen::VectorXd& x, Eigen::VectorXd& y) const;
+	Eigen::VectorXd operator*(const Eigen::VectorXd& x) const;
+
+	// Calls f(row, col, value) for every entry of the stored blocks, or only of the diagonal blocks
+	template <typename F> void forEach(F f, bool diagonal = false) const
+	{
+		for (int r = 0; r < blockRows(); r++) {
+			int rs = blockSize(r);
+			for (int k = rowPtr[r]; k < rowPtr[r + 1]; k++) {
+				int c = colIdx[k];
+				if (diagonal && c != r) continue;
+				int cs = blockSize(c);
+				for (int j = 0; j < rs; j++) {
+					for (int l = 0; l < cs; l++) f(start[r] + j, start[c] + l, values[9 * k + 3 * j + l]);
+				}
+			}
+		}
+	}
+
+	// Scalar CSC copy, for debug dumps
+	Eigen::SparseMatrix<double> toSparse() const;
+
+private:
+	std::vector<int> start; // Variable offset of every block row and column, the last entry is the size
+	int lagrangian;
+
+	std::vector<int> rowPtr;
+	std::vector<int> colIdx;
+	std::vector<double> values; // 9 per stored block
+
+	int blockOf(int offset) const { return offset < lagrangian ? offset / 3 : lagrangian / 3 + (offset - lagrangian) / 2; }
+	int blockSize(int b) const { return start[b + 1] - start[b]; }
+};
+
+#endif
@@ -0,0 +1,117 @@
+#include "BlockSystem.h"
+#include "BlockPreconditioner.h"
+
+using namespace std;
+using namespace Eigen;
+
+BlockSystem::BlockSystem() :
+	B(NULL),
+	n(0),
+	shift(0.0)
+{
+
+}
+
+BlockSystem::BlockSystem(const BlockSparseMatrix& B) :
+	B(&B),
+	n(B.rows()),
+	shift(0.0)
+{
+
+}
+
+BlockSystem::BlockSystem(const BlockSparseMatrix& B, const VectorXi& freeIndex, int nfree) :
+	B(&B),
+	freeIndex(freeIndex),
+	n(nfree),
+	shift(0.0)
+{
+
+}
+
+void BlockSystem::setPenalty(double shift, const SparseMatrix<double>& C, const VectorXd& w)
+{
+	this->shift = shift;
+	this->C = C;
+	this->w = w;
+}
+
+void BlockSystem::multiply(const VectorXd& x, VectorXd& y) const
+{
+	if (freeIndex.size() == 0) {
+		B->multiply(x, y);
+	}
+	else {
+		// Eliminated variables are zero in the product
+		xfull.setZero(B->rows());
+		for (int i = 0; i < freeIndex.size(); i++) {
+			if (freeIndex(i) >= 0) xfull(i) = x(freeIndex(i));
+		}
+		B->multiply(xfull, yfull);
+		y.resize(n);
+		for (int i = 0; i < freeIndex.size(); i++) {
+			if (freeIndex(i) >= 0) y(freeIndex(i)) = yfull(i);
+		}
+	}
+	if (shift != 0.0) y += shift * x;
+	if (C.rows() > 0) y += C.transpose() * w.cwiseProduct(C * x);
+}
+
+void BlockSystem::addDiagonalBlocks(const vector<int>& blockOf, const vector<int>& blockStart, vector<Matrix3d>& blocks) const
+{
+	B->forEach([&](int i, int j, double v) {
+		if (freeIndex.size() > 0) {
+			i = freeIndex(i);
+			j = freeIndex(j);
+			if (i < 0 || j < 0) return;
+		}
+		int b = blockOf[i];
+		if (blockOf[j] == b) blocks[b](i - blockStart[b], j - blockStart[b]) += v;
+	}, true);
+
+	for (int i = 0; i < n && shift != 0.0; i++) {
+		int b = blockOf[i];
+		blocks[b](i - blockStart[b], i - blockStart[b]) += shift;
+	}
+
+	// C'*diag(w)*C, row by row
+	for (int r = 0; r < C.rows(); r++) {
+		for (SparseMatrix<double, RowMajor>::InnerIterator it(C, r); it; ++it) {
+			int b = blockOf[it.col()];
+			for (SparseMatrix<double, RowMajor>::InnerIterator jt(C, r); jt; ++jt) {
+				if (blockOf[jt.col()] == b) blocks[b](it.col() - blockStart[b], jt.col() - blockStart[b]) += w(r) * it.value() * jt.value();
+			}
+		}
+	}
+}
+
+void BlockSystem::triplets(vector<Triplet<double> >& t, bool lower, int offset) const
+{
+	B->forEach([&](int i, int j, double v) {
+		if (freeIndex.size() > 0) {
+			i = freeIndex(i);
+			j = freeIndex(j);
+			if (i < 0 || j < 0) return;
+		}
+		if (!lower || i >= j) t.push_back(Triplet<double>(offset + i, offset + j, v));
+	});
+}
+
+SparseMatrix<double> BlockSystem::toSparse() const
+{
+	vector<Triplet<double> > a_;
+	a_.reserve(nonZeros());
+	triplets(a_, false);
+	SparseMatrix<double> A(n, n);
+	A.setFromTriplets(a_.begin(), a_.end());
+	return A;
+}
+
+BlockJacobiPreconditioner& BlockJacobiPreconditioner::factorize(const BlockSystem& mat)
+{
+	vector<int> blockOf;
+	setup(mat.cols(), blockOf);
+	mat.addDiagonalBlocks(blockOf, blockStart, inv);
+	invert();
+	return *this;
+}
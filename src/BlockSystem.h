@@ -0,0 +1,98 @@
+#pragma once
+#ifndef __BlockSystem__
+#define __BlockSystem__
+
+#include <vector>
+
+#define EIGEN_DONT_ALIGN_STATICALLY
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include "BlockSparseMatrix.h"
+
+class BlockSystem;
+
+namespace Eigen {
+namespace internal {
+	// Lets Eigen's iterative solvers take a BlockSystem in place of a sparse matrix
+	template<>
+	struct traits<BlockSystem> : public traits<SparseMatrix<double> > {};
+}
+}
+
+// Matrix free view of S*B*S' + shift*I + C'*diag(w)*C for the solvers
+// B is the block assembled system, S keeps the variables with a non negative entry in freeIndex, or all of them without one
+// The products go through the blocks, a scalar copy is only assembled by toSparse and triplets
+class BlockSystem : public Eigen::EigenBase<BlockSystem>
+{
+public:
+	typedef double Scalar;
+	typedef double RealScalar;
+	typedef int StorageIndex;
+	enum {
+		ColsAtCompileTime = Eigen::Dynamic,
+		MaxColsAtCompileTime = Eigen::Dynamic,
+		IsRowMajor = false
+	};
+
+	BlockSystem();
+	BlockSystem(const BlockSparseMatrix& B);
+	BlockSystem(const BlockSparseMatrix& B, const Eigen::VectorXi& freeIndex, int nfree);
+
+	Eigen::Index rows() const { return n; }
+	Eigen::Index cols() const { return n; }
+
+	// Adds shift*I + C'*diag(w)*C, the native QP's reduced system uses it for sigma and the constraint penalty
+	void setPenalty(double shift, const Eigen::SparseMatrix<double>& C, const Eigen::VectorXd& w);
+
+	// y = (S*B*S' + shift*I + C'*diag(w)*C)*x
+	void multiply(const Eigen::VectorXd& x, Eigen::VectorXd& y) const;
+
+	template<typename Rhs>
+	Eigen::Product<BlockSystem, Rhs, Eigen::AliasFreeProduct> operator*(const Eigen::MatrixBase<Rhs>& x) const
+	{
+		return Eigen::Product<BlockSystem, Rhs, Eigen::AliasFreeProduct>(*this, x.derived());
+	}
+
+	// Adds the entries whose row and column are both in the same preconditioner block into that block
+	void addDiagonalBlocks(const std::vector<int>& blockOf, const std::vector<int>& blockStart, std::vector<Eigen::Matrix3d>& blocks) const;
+
+	// Entries of S*B*S', only the lower triangle when lower is set, with every index moved down and right by offset
+	void triplets(std::vector<Eigen::Triplet<double> >& t, bool lower, int offset = 0) const;
+
+	// S*B*S' as CSC, for the external QP solvers and IC(0)
+	Eigen::SparseMatrix<double> toSparse() const;
+
+	int nonZeros() const { return B ? 9 * B->nonZeroBlocks() : 0; }
+
+private:
+	const BlockSparseMatrix* B;
+	Eigen::VectorXi freeIndex; // Empty when every variable is kept
+	int n;
+
+	double shift;
+	Eigen::SparseMatrix<double, Eigen::RowMajor> C;
+	Eigen::VectorXd w;
+
+	// Full size work vectors, kept so every product doesn't allocate
+	mutable Eigen::VectorXd xfull, yfull;
+};
+
+namespace Eigen {
+namespace internal {
+	template<typename Rhs>
+	struct generic_product_impl<BlockSystem, Rhs, SparseShape, DenseShape, GemvProduct>
+		: generic_product_impl_base<BlockSystem, Rhs, generic_product_impl<BlockSystem, Rhs> >
+	{
+		template<typename Dest>
+		static void scaleAndAddTo(Dest& dst, const BlockSystem& lhs, const Rhs& rhs, const double& alpha)
+		{
+			VectorXd y;
+			lhs.multiply(rhs, y);
+			dst += alpha * y;
+		}
+	};
+}
+}
+
+#endif
@@ -7,10 +7,14 @@
 #include "GeneralizedSolver.h"
 #include "UtilEOL.h"
 #include "matlabOutputs.h"
+#include "DebugDump.h"
 
 #include "external/ArcSim/mesh.hpp"
 #include "external/ArcSim/io.hpp"
 #include "external/ArcSim/geometry.hpp"
+#include "external/ArcSim/facegrid.hpp"
+
+#include <cmath>
 
 #ifdef EOLC_ONLINE
 #define GLM_FORCE_RADIANS
@@ -27,10 +31,13 @@ using namespace std;
 using namespace Eigen;
 
 Cloth::Cloth() :
+	verifyTransfer(false),
+	transferMismatches(0),
 	fsindex(0)
 {
 	consts = make_shared<Constraints>();
 	myForces = make_shared<Forces>();
+	dump = make_shared<DebugDump>();
 }
 
 void Cloth::build(const Vector2i res,
@@ -188,8 +195,9 @@ void Cloth::updateBuffers()
 
 void Cloth::updatePreviousMesh()
 {
-	delete_mesh(last_mesh);
-	last_mesh = deep_copy(mesh);
+	last_mesh.capture(mesh);
+	// Preprocessing looks up enclosing faces in the live mesh
+	build_face_grid(mesh);
 }
 
 void Cloth::velocityTransfer()
@@ -197,6 +205,10 @@ void Cloth::velocityTransfer()
 	v.resize(mesh.nodes.size() * 3 + mesh.EoL_Count * 2);
 	v.setZero();
 
+	// New nodes are usually near the previous one, so the last enclosing face is a good place to start looking
+	int last_face = -1;
+	transferMismatches = 0;
+
 	// Loop through all of our nodes and update their velocities
 	for (int n = 0; n < mesh.nodes.size(); n++) {
 		Node* node = mesh.nodes[n];
@@ -204,16 +216,25 @@ void Cloth::velocityTransfer()
 
 		// Search through the unremeshed mesh to see if this node existed before, or was just introduced it this step
 		// TODO:: Can more than one node fall within the close range? 
-		bool found = false;
-		double how_close = 1e-6;
-		int closest = -1;
-		for (int j = 0; j < last_mesh.nodes.size(); j++) {
-			double dist = unsigned_vv_distance(vert->u, last_mesh.nodes[j]->verts[0]->u);
-			if (unsigned_vv_distance(vert->u, last_mesh.nodes[j]->verts[0]->u) < how_close) {
-				how_close = dist;
-				closest = j;
-				found = true;
-				break;
+		int closest = last_mesh.findNode(Vector2d(vert->u[0], vert->u[1]));
+		bool found = closest >= 0;
+
+		if (verifyTransfer) {
+			// The original search, the first old node within the tolerance
+			int closest_brute = -1;
+			for (int j = 0; j < last_mesh.numNodes(); j++) {
+				if (unsigned_vv_distance(vert->u, Vec3(last_mesh.u[2 * j], last_mesh.u[2 * j + 1], 0.0)) < last_mesh.matchTol) {
+					closest_brute = j;
+					break;
+				}
+			}
+			if (closest != closest_brute) {
+				transferMismatches++;
+				cout << "velocityTransfer: node " << n << " matched old node " << closest << " but brute force matched " << closest_brute;
+				if (closest >= 0 && closest_brute >= 0) {
+					cout << ", velocity difference " << (last_mesh.nodeVelocity(closest) - last_mesh.nodeVelocity(closest_brute)).norm();
+				}
+				cout << endl;
 			}
 		}
 
@@ -251,15 +272,18 @@ void Cloth::velocityTransfer()
 		else {
 			// If its a LAG point we can just use barycentric averaging
 			if (!node->EoL) {
-				Face* old_face = get_enclosing_face(last_mesh, Vec2(vert->u[0], vert->u[1]));
-				Vec3 bary = get_barycentric_coords(Vec2(vert->u[0], vert->u[1]), old_face);
-				Vector3d vwA = v2e(old_face->v[0]->node->v);
-				Vector3d vwB = v2e(old_face->v[1]->node->v);
-				Vector3d vwC = v2e(old_face->v[2]->node->v);
+				Vector2d X(vert->u[0], vert->u[1]);
+				int old_face = last_mesh.enclosingFace(X, last_face);
+				last_face = old_face;
+				Vector3d bary = last_mesh.barycentric(old_face, X);
+				int oA = last_mesh.faceNode(old_face, 0), oB = last_mesh.faceNode(old_face, 1), oC = last_mesh.faceNode(old_face, 2);
+				Vector3d vwA = last_mesh.nodeVelocity(oA);
+				Vector3d vwB = last_mesh.nodeVelocity(oB);
+				Vector3d vwC = last_mesh.nodeVelocity(oC);
 				// If any of its surrounding points are EOL, the Eulerian component velocity component must be taken into account
-				if (old_face->v[0]->node->EoL) vwA += -deform_grad(old_face) * v322e(old_face->v[0]->v);
-				if (old_face->v[1]->node->EoL) vwB += -deform_grad(old_face) * v322e(old_face->v[1]->v);
-				if (old_face->v[2]->node->EoL) vwC += -deform_grad(old_face) * v322e(old_face->v[2]->v);
+				if (last_mesh.nodeEoL(oA)) vwA += -last_mesh.deformGrad(old_face) * last_mesh.nodeMaterialVelocity(oA);
+				if (last_mesh.nodeEoL(oB)) vwB += -last_mesh.deformGrad(old_face) * last_mesh.nodeMaterialVelocity(oB);
+				if (last_mesh.nodeEoL(oC)) vwC += -last_mesh.deformGrad(old_face) * last_mesh.nodeMaterialVelocity(oC);
 				Vector3d v_new_world = bary[0] * vwA + bary[1] * vwB + bary[2] * vwC;
 				node->v = e2v(v_new_world);
 				v(3 * n) = v_new_world(0);
@@ -292,9 +316,11 @@ void Cloth::velocityTransfer()
 				}
 				// If this is brand new EOL with no previuosly known information, we calculate its world velocity and distribute it
 				else {
-					Face* old_face = get_enclosing_face(last_mesh, Vec2(vert->u[0], vert->u[1]));
-					Matrix2d ftf = deform_grad(old_face).transpose() * deform_grad(old_face);
-					Vector2d dtv = -deform_grad(old_face).transpose() * v2e(node->v);
+					int old_face = last_mesh.enclosingFace(Vector2d(vert->u[0], vert->u[1]), last_face);
+					last_face = old_face;
+					MatrixXd F = last_mesh.deformGrad(old_face);
+					Matrix2d ftf = F.transpose() * F;
+					Vector2d dtv = -F.transpose() * v2e(node->v);
 
 					// We set up a simple KKT system with the purpose of putting as much world velocity as possible into the Eulerian component
 					MatrixXd KKTl = MatrixXd::Zero(4, 4);
@@ -313,7 +339,7 @@ void Cloth::velocityTransfer()
 					v(mesh.nodes.size() * 3 + node->EoL_index * 2 + 1) = newvE(1);
 
 					// We use the deformation gradient to extract the lagrangian component
-					Vector3d newvL = v2e(node->v) + -deform_grad(old_face) * newvE.segment<2>(0);
+					Vector3d newvL = v2e(node->v) + -F * newvE.segment<2>(0);
 					node->v = e2v(newvL);
 					v(3 * n) = newvL(0);
 					v(3 * n + 1) = newvL(1);
@@ -324,36 +350,33 @@ void Cloth::velocityTransfer()
 	}
 }
 
-void generateMatlab(const SparseMatrix<double>& M,
-	const SparseMatrix<double>& MDK, const VectorXd& b,
-	const SparseMatrix<double>& Aeq, const VectorXd& beq,
-	const SparseMatrix<double>& Aineq, const VectorXd& bineq,
-	VectorXd& v)
-{
-	mat_s2s_file(M, "M", "solver.m", false);
-	mat_s2s_file(MDK, "MDK", "solver.m", false);
-	vec_to_file(b, "b", "solver.m", false);
-	mat_s2s_file(Aeq, "Aeq", "solver.m", false);
-	vec_to_file(beq, "beq", "solver.m", false);
-	mat_s2s_file(Aineq, "Aineq", "solver.m", false);
-	vec_to_file(bineq, "bineq", "solver.m", false);
-	vec_to_file(v, "v_input", "solver.m", false);
-}
-
 void Cloth::solve(shared_ptr<GeneralizedSolver> gs, double h)
 {
-	VectorXd b = -(myForces->M * v + h * myForces->f);
-	generateMatlab(myForces->M,
-		myForces->MDK, b,
-		consts->Aeq, consts->beq,
-		consts->Aineq, consts->bineq,
-		v);
-	bool success = gs->velocitySolve(consts->hasFixed, consts->hasCollisions,
-		myForces->MDK, b,
+	VectorXd b = -(myForces->Mb * v + h * myForces->f);
+	if (dump->active()) {
+		dump->add("M", myForces->Mb.toSparse());
+		dump->add("MDK", myForces->MDKb.toSparse());
+		dump->add("b", b);
+		dump->add("Aeq", consts->Aeq);
+		dump->add("beq", consts->beq);
+		dump->add("Aineq", consts->Aineq);
+		dump->add("bineq", consts->bineq);
+		dump->add("v_input", v);
+		// Eliminated fixed coordinates as rows of [1-based index, velocity]
+		MatrixXd pinned(consts->pinned.size(), 2);
+		for (int i = 0; i < consts->pinned.size(); i++) {
+			pinned(i, 0) = consts->pinned[i].first + 1;
+			pinned(i, 1) = consts->pinned[i].second;
+		}
+		dump->add("pinned", pinned);
+	}
+	gs->lagrangianSize = mesh.nodes.size() * 3;
+	bool success = gs->velocitySolve(consts->hasFixed, consts->hasCollisions, consts->pinned,
+		myForces->MDKb, b,
 		consts->Aeq, consts->beq,
 		consts->Aineq, consts->bineq,
 		v);
-	vec_to_file(v, "v_solved", "solver.m", false);
+	dump->add("v_solved", v);
 }
 
 void Cloth::step(shared_ptr<GeneralizedSolver> gs, shared_ptr<Obstacles> obs, const Vector3d& grav, double h, const bool& REMESHon, const bool& online)
@@ -363,33 +386,37 @@ void Cloth::step(shared_ptr<GeneralizedSolver> gs, shared_ptr<Obstacles> obs, co
 	consts->fill(mesh, obs, fs[fsindex], h, online);
 	if(REMESHon) velocityTransfer();
 	myForces->fill(mesh, material, grav, h);
-	double_to_file(h, "h", "solver.m", true);
-	double_to_file(grav(2), "grav", "solver.m", false);
-	double_to_file(material.density, "rho", "solver.m", false);
-	double_to_file(material.e, "e", "solver.m", false);
-	double_to_file(material.nu, "nu", "solver.m", false);
-	MatrixXd x_X(mesh.nodes.size(), 5);
-	VectorXi isEoL(mesh.nodes.size());
-	isEoL.setZero();
-	for (int i = 0; i < mesh.nodes.size(); i++) {
-		if (mesh.nodes[i]->EoL) isEoL(i) = 1;
-		x_X(i, 0) = mesh.nodes[i]->x[0];
-		x_X(i, 1) = mesh.nodes[i]->x[1];
-		x_X(i, 2) = mesh.nodes[i]->x[2];
-		x_X(i, 3) = mesh.nodes[i]->verts[0]->u[0];
-		x_X(i, 4) = mesh.nodes[i]->verts[0]->u[1];
-	}
-	mat_to_file(x_X, "x_X", "solver.m", false);
-	vec_to_file(isEoL, "isEol","solver.m",false);
-	MatrixXi faces2(3, mesh.faces.size());
-	for (int i = 0; i < mesh.faces.size(); i++) {
-		faces2.col(i) = Vector3i(mesh.faces[i]->v[0]->node->index, mesh.faces[i]->v[1]->node->index, mesh.faces[i]->v[2]->node->index);
+	dump->beginFrame();
+	if (dump->active()) {
+		dump->add("h", h);
+		dump->add("grav", grav(2));
+		dump->add("rho", material.density);
+		dump->add("e", material.e);
+		dump->add("nu", material.nu);
+		MatrixXd x_X(mesh.nodes.size(), 5);
+		VectorXi isEoL(mesh.nodes.size());
+		isEoL.setZero();
+		for (int i = 0; i < mesh.nodes.size(); i++) {
+			if (mesh.nodes[i]->EoL) isEoL(i) = 1;
+			x_X(i, 0) = mesh.nodes[i]->x[0];
+			x_X(i, 1) = mesh.nodes[i]->x[1];
+			x_X(i, 2) = mesh.nodes[i]->x[2];
+			x_X(i, 3) = mesh.nodes[i]->verts[0]->u[0];
+			x_X(i, 4) = mesh.nodes[i]->verts[0]->u[1];
+		}
+		dump->add("x_X", x_X);
+		dump->add("isEol", isEoL);
+		MatrixXi faces2(3, mesh.faces.size());
+		for (int i = 0; i < mesh.faces.size(); i++) {
+			faces2.col(i) = Vector3i(mesh.faces[i]->v[0]->node->index, mesh.faces[i]->v[1]->node->index, mesh.faces[i]->v[2]->node->index);
+		}
+		VectorXi vvv(3);
+		vvv << 1, 1, 1;
+		dump->add("faces", MatrixXi(faces2.colwise() += vvv));
+		dump->add("f", myForces->f);
 	}
-	VectorXi vvv(3);
-	vvv << 1, 1, 1;
-	mat_to_file(faces2.colwise() += vvv, "faces", "solver.m",false);
-	vec_to_file(myForces->f, "f", "solver.m", false);
 	solve(gs, h);
+	dump->endFrame();
 
 	for (int n = 0; n < mesh.nodes.size(); n++) {
 		Node* node = mesh.nodes[n];
@@ -13,12 +13,14 @@
 #include "external/ArcSim//mesh.hpp"
 
 #include "Brenderable.h"
+#include "MeshSnapshot.h"
 
 class Obstacles;
 class FixedList;
 class Constraints;
 class Forces;
 class GeneralizedSolver;
+class DebugDump;
 
 #ifdef EOLC_ONLINE
 class MatrixStack;
@@ -38,6 +40,7 @@ extern struct Remeshing {
 	double refine_angle, refine_compression, refine_velocity;
 	double size_min, size_max; // size limits
 	double aspect_min; // aspect ratio control
+	int threads; // sizing field, split and flip workers, 0 uses every hardware thread, anything but 1 splits in rounds of independent edges
 };
 
 class Cloth : public Brenderable
@@ -49,12 +52,19 @@ public:
 	Remeshing remeshing;
 	Material material;
 
-	Mesh last_mesh;
+	// The mesh as it was before this step's preprocessing and remeshing
+	MeshSnapshot last_mesh;
+
+	// Checks the node matching of velocityTransfer against the original O(N^2) search every step
+	// transferMismatches counts the nodes of the last transfer where the matched old node differs
+	bool verifyTransfer;
+	int transferMismatches;
 
 	std::vector<std::shared_ptr<FixedList> > fs;
 
 	std::shared_ptr<Constraints> consts;
 	std::shared_ptr<Forces> myForces;
+	std::shared_ptr<DebugDump> dump;
 
 	Eigen::MatrixXd boundaries;
 	
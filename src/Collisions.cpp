@@ -2,49 +2,133 @@
 #include "Box.h"
 #include "Points.h"
 
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
 #define EIGEN_DONT_ALIGN_STATICALLY
 #include <Eigen/Dense>
 
 using namespace std;
 using namespace Eigen;
 
-void CD(const Mesh& mesh, const shared_ptr<Obstacles> obs, std::vector<std::shared_ptr<btc::Collision> > &cls)
+CollisionMesh::CollisionMesh() :
+	topologyValid(false),
+	positionsValid(false),
+	threshold(0.0),
+	seed(1)
 {
-	MatrixXd verts2(3, mesh.nodes.size());
-	MatrixXi faces2(3, mesh.faces.size());
-	//VectorXi EoLs(1, mesh.nodes.size());
-	VectorXi EoLs;
-	EoLs.resize(mesh.nodes.size());
 
+}
 
+void CollisionMesh::invalidate()
+{
+	topologyValid = false;
+	positionsValid = false;
+	bvh.invalidate();
+}
 
+void CollisionMesh::update(const Mesh& mesh, double threshold, unsigned int seed)
+{
+	if (verts.cols() != mesh.nodes.size() || faces.cols() != mesh.faces.size() || seed != this->seed) invalidate();
+	if (threshold != this->threshold) positionsValid = false;
+	if (topologyValid && positionsValid) return;
+	this->threshold = threshold;
+	this->seed = seed;
+
+	verts.resize(3, mesh.nodes.size());
+	EoLs.resize(mesh.nodes.size());
 	for (int i = 0; i < mesh.nodes.size(); i++) {
-		verts2.col(i) = Vector3d(mesh.nodes[i]->x[0], mesh.nodes[i]->x[1], mesh.nodes[i]->x[2]);
-		if (mesh.nodes[i]->EoL) EoLs(i) = 1;
+		verts.col(i) = Vector3d(mesh.nodes[i]->x[0], mesh.nodes[i]->x[1], mesh.nodes[i]->x[2]);
+		EoLs(i) = mesh.nodes[i]->EoL ? 1 : 0;
+	}
+
+	if (!topologyValid) {
+		faces.resize(3, mesh.faces.size());
+		for (int i = 0; i < mesh.faces.size(); i++) {
+			faces.col(i) = Vector3i(mesh.faces[i]->v[0]->node->index, mesh.faces[i]->v[1]->node->index, mesh.faces[i]->v[2]->node->index);
+		}
+		faceNors = btc::createFaceNormals(faces, verts);
+		edges.clear();
+		btc::createEdges(edges, faces, verts);
+		jitter = btc::createJitter(verts.cols(), seed);
+		topologyValid = true;
 	}
-	for (int i = 0; i < mesh.faces.size(); i++) {
-		faces2.col(i) = Vector3i(mesh.faces[i]->v[0]->node->index, mesh.faces[i]->v[1]->node->index, mesh.faces[i]->v[2]->node->index);
+	else {
+		faceNors = btc::createFaceNormals(faces, verts);
+		// createEdges takes the edge normals from the same cross product as the face normals
+		for (int k = 0; k < edges.size(); k++) {
+			btc::Edge& e = *edges[k];
+			e.normals[0] = faceNors.col(e.faces(0));
+			if (e.internal) {
+				e.normals[1] = faceNors.col(e.faces(1));
+				e.angle = acos(e.normals[0].dot(e.normals[1]));
+			}
+		}
 	}
-	
-	// Compute these first so they form the base of our collision list
-	btc::pointTriCollision(cls, obs->cdthreshold, obs->points->pxyz, obs->points->norms, verts2, faces2, true);
+
+	btc::perturbVerts(pverts, verts, jitter, threshold);
+	pfaceNors = btc::createFaceNormals(faces, pverts);
+	bvh.update(pverts, faces, edges);
+	positionsValid = true;
+}
+
+// Runs the point set query and one query per box, spread over obs->threads workers
+// cm.taskCls[0] gets the point collisions and cm.taskCls[b + 1] the collisions of box b
+static void CDTasks(CollisionMesh& cm, const shared_ptr<Obstacles> obs, bool pointsEOL)
+{
+	vector<vector<btc::Collision> > &results = cm.taskCls;
+	int ntasks = obs->num_boxes + 1;
+	results.resize(ntasks);
+	for (int k = 0; k < ntasks; k++) results[k].clear();
+
+	int nthreads = obs->threads > 0 ? obs->threads : max((int)thread::hardware_concurrency(), 1);
+	nthreads = max(min(nthreads, ntasks), 1);
+
+	// Boxes can differ a lot in contact count, so workers take the next free task
+	atomic<int> next(0);
+	auto work = [&]() {
+		for (int k = next++; k < ntasks; k = next++) {
+			if (k == 0) {
+				btc::pointTriCollision(results[0], obs->cdthreshold, obs->points->pxyz, obs->points->norms, cm.pverts, cm.pfaceNors, cm.faces, pointsEOL, cm.bvh);
+			}
+			else {
+				int b = k - 1;
+				btc::boxTriCollision(results[k], obs->cdthreshold, obs->boxes[b]->dim, obs->boxes[b]->E1, cm.pverts, cm.pfaceNors, cm.faces, false, cm.edges, cm.bvh);
+			}
+		}
+	};
+	vector<thread> workers;
+	for (int t = 1; t < nthreads; t++) workers.push_back(thread(work));
+	work();
+	for (int t = 0; t < workers.size(); t++) workers[t].join();
+}
+
+void CD(const Mesh& mesh, const shared_ptr<Obstacles> obs, std::vector<btc::Collision> &cls)
+{
+	obs->cmesh->update(mesh, obs->cdthreshold, obs->cdseed);
+	CDTasks(*obs->cmesh, obs, true);
+	const vector<vector<btc::Collision> > &results = obs->cmesh->taskCls;
+
+	// Merged in task order so the list is the same for any number of threads
+	// The points go first so they form the base of our collision list
+	cls.insert(cls.end(), results[0].begin(), results[0].end());
 
 	int c = cls.size();
 	for (int b = 0; b < obs->num_boxes; b++) {
-		vector<shared_ptr<btc::Collision> > clst;
-		btc::boxTriCollision(clst, obs->cdthreshold, obs->boxes[b]->dim, obs->boxes[b]->E1, verts2, faces2, EoLs, false);
+		const vector<btc::Collision> &clst = results[b + 1];
 		cls.insert(cls.end(), clst.begin(), clst.end());
 		// We need to augment the indices of the box geometry by the object number
 		// TODO:: Internally?
 		for (c; c < cls.size(); c++) {
-			if (cls[c]->count1 == 1 && cls[c]->count2 == 3) {
-				//cls[c]->verts1(0) = obs->points->num_points + (obs->boxes[b]->num_points * b) + cls[c]->verts1(0);
-				cls[c]->verts1(0) = obs->points->num_points + (b* obs->boxes[b]->num_points) + (b* obs->boxes[b]->num_edges) + cls[c]->verts1(0);
+			if (cls[c].count1 == 1 && cls[c].count2 == 3) {
+				//cls[c].verts1(0) = obs->points->num_points + (obs->boxes[b]->num_points * b) + cls[c].verts1(0);
+				cls[c].verts1(0) = obs->points->num_points + (b* obs->boxes[b]->num_points) + (b* obs->boxes[b]->num_edges) + cls[c].verts1(0);
 			}
-			for (int e = 0; e < cls[c]->edge1.size(); e++) {
-				//cls[c]->edge1[e] = obs->points->num_points + (obs->boxes[b]->num_edges * b) + cls[c]->edge1[e];
-				//cls[c]->edge1[e] = (obs->boxes[b]->num_edges * b) + cls[c]->edge1[e];
-				cls[c]->edge1[e] = obs->points->num_points + (b* obs->boxes[b]->num_points) + (b* obs->boxes[b]->num_edges) + (obs->boxes[b]->num_points + cls[c]->edge1[e]);
+			for (int e = 0; e < cls[c].nedge1; e++) {
+				//cls[c].edge1[e] = obs->points->num_points + (obs->boxes[b]->num_edges * b) + cls[c].edge1[e];
+				//cls[c].edge1[e] = (obs->boxes[b]->num_edges * b) + cls[c].edge1[e];
+				cls[c].edge1[e] = obs->points->num_points + (b* obs->boxes[b]->num_points) + (b* obs->boxes[b]->num_edges) + (obs->boxes[b]->num_points + cls[c].edge1[e]);
 			}
 		}
 	}
@@ -52,27 +136,13 @@ void CD(const Mesh& mesh, const shared_ptr<Obstacles> obs, std::vector<std::shar
 	
 }
 
-void CD2(const Mesh& mesh, const shared_ptr<Obstacles> obs, std::vector<std::shared_ptr<btc::Collision> > &cls)
+void CD2(const Mesh& mesh, const shared_ptr<Obstacles> obs, std::vector<btc::Collision> &cls)
 {
-	MatrixXd verts2(3, mesh.nodes.size());
-	MatrixXi faces2(3, mesh.faces.size());
-	VectorXi EoLs;
-	EoLs.resize(mesh.nodes.size());
+	obs->cmesh->update(mesh, obs->cdthreshold, obs->cdseed);
+	CDTasks(*obs->cmesh, obs, false);
+	const vector<vector<btc::Collision> > &results = obs->cmesh->taskCls;
 
-	for (int i = 0; i < mesh.nodes.size(); i++) {
-		verts2.col(i) = Vector3d(mesh.nodes[i]->x[0], mesh.nodes[i]->x[1], mesh.nodes[i]->x[2]);
-		if (mesh.nodes[i]->EoL) EoLs(i) = 1;
-	}
-	for (int i = 0; i < mesh.faces.size(); i++) {
-		faces2.col(i) = Vector3i(mesh.faces[i]->v[0]->node->index, mesh.faces[i]->v[1]->node->index, mesh.faces[i]->v[2]->node->index);
+	for (int k = 0; k < results.size(); k++) {
+		cls.insert(cls.end(), results[k].begin(), results[k].end());
 	}
-
-	// Compute these first so they form the base of our collision list
-	btc::pointTriCollision(cls, obs->cdthreshold, obs->points->pxyz, obs->points->norms, verts2, faces2, false);
-
-	for (int b = 0; b < obs->num_boxes; b++) {
-		vector<shared_ptr<btc::Collision> > clst;
-		btc::boxTriCollision(clst, obs->cdthreshold, obs->boxes[b]->dim, obs->boxes[b]->E1, verts2, faces2, EoLs, false);
-		cls.insert(cls.end(), clst.begin(), clst.end());
-	}
-}
\ No newline at end of file
+}
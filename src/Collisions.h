@@ -6,8 +6,48 @@
 #include "boxTriCollision.h"
 #include "Obstacles.h"
 
-void CD(const Mesh& mesh, const std::shared_ptr<Obstacles> obs, std::vector<std::shared_ptr<btc::Collision> > &cls);
+// Flat copy of the cloth for the collision queries, shared by CD, CD2 and every obstacle
+// The faces, edges and trees are only rebuilt after invalidate(), the positions only refreshed after invalidatePositions()
+class CollisionMesh
+{
+public:
+	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
-void CD2(const Mesh& mesh, const std::shared_ptr<Obstacles> obs, std::vector<std::shared_ptr<btc::Collision> > &cls);
+	CollisionMesh();
+	virtual ~CollisionMesh() {}
 
-#endif
\ No newline at end of file
+	Eigen::MatrixXd verts;
+	Eigen::MatrixXi faces;
+	Eigen::VectorXi EoLs;
+	std::vector<std::shared_ptr<btc::Edge> > edges;
+	Eigen::MatrixXd faceNors;
+
+	// The narrow phase works on the verts moved by a fixed per vertex jitter, see btc::createJitter
+	Eigen::MatrixXd jitter;
+	Eigen::MatrixXd pverts;
+	Eigen::MatrixXd pfaceNors;
+	btc::ClothBVH bvh; // Over pverts
+
+	// Collision list of every point set and box query, kept so their storage is reused
+	std::vector<std::vector<btc::Collision> > taskCls;
+
+	// Brings the copy up to date with mesh, threshold scales the jitter
+	void update(const Mesh& mesh, double threshold, unsigned int seed);
+
+	// Call whenever the cloth topology changes
+	void invalidate();
+	// Call whenever the cloth moves
+	void invalidatePositions() { positionsValid = false; }
+
+private:
+	bool topologyValid;
+	bool positionsValid;
+	double threshold;
+	unsigned int seed;
+};
+
+void CD(const Mesh& mesh, const std::shared_ptr<Obstacles> obs, std::vector<btc::Collision> &cls);
+
+void CD2(const Mesh& mesh, const std::shared_ptr<Obstacles> obs, std::vector<btc::Collision> &cls);
+
+#endif
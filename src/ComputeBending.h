@@ -2,6 +2,8 @@
 #ifndef __ComputeBending__
 #define __ComputeBending__
 
+#include "SimdPack.h"
+
 void ComputeBending(
 	const double *x0, // [input 3x1] World position of vertex 0
 	const double *x1, // [input 3x1] World position of vertex 1
@@ -17,4 +19,21 @@ void ComputeBending(
 	double *K)        // [output 12x12] Bending stiffness matrix
 	;
 
+// Same kernel over ElementPack::Width elements at once, one element per lane
+// The arrays have the layout above with every double replaced by a pack
+void ComputeBending(
+	const ElementPack *x0,   // [input 3x1] World position of vertex 0
+	const ElementPack *x1,   // [input 3x1] World position of vertex 1
+	const ElementPack *x2,   // [input 3x1] World position of vertex 2
+	const ElementPack *x3,   // [input 3x1] World position of vertex 3
+	const ElementPack *X0,   // [input 2x1] Material position of vertex 0
+	const ElementPack *X1,   // [input 2x1] Material position of vertex 1
+	const ElementPack *X2,   // [input 2x1] Material position of vertex 2
+	const ElementPack *X3,   // [input 2x1] Material position of vertex 3
+	const ElementPack &beta, // [input 1x1] Bending stiffness 
+	ElementPack *W,          // [output 1x1] Bending potential energy
+	ElementPack *f,          // [output 12x1] Bending force vector
+	ElementPack *K)          // [output 12x12] Bending stiffness matrix
+	;
+
 #endif
\ No newline at end of file
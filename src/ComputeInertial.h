@@ -2,6 +2,8 @@
 #ifndef __ComputeInertial__
 #define __ComputeInertial__
 
+#include "SimdPack.h"
+
 void ComputeInertial(
 	const double *xa, // [input 3x1] World position of vertex A
 	const double *xb, // [input 3x1] World position of vertex B
@@ -16,4 +18,20 @@ void ComputeInertial(
 	double *M)        // [output 9x9] Inertia matrix
 	;
 
+// Same kernel over ElementPack::Width elements at once, one element per lane
+// The arrays have the layout above with every double replaced by a pack
+void ComputeInertial(
+	const ElementPack *xa,  // [input 3x1] World position of vertex A
+	const ElementPack *xb,  // [input 3x1] World position of vertex B
+	const ElementPack *xc,  // [input 3x1] World position of vertex C
+	const ElementPack *Xa,  // [input 2x1] Material position of vertex A
+	const ElementPack *Xb,  // [input 2x1] Material position of vertex B
+	const ElementPack *Xc,  // [input 2x1] Material position of vertex C
+	const ElementPack *g,   // [input 3x1] 3D gravity vector
+	const ElementPack &rho, // [input 1x1] Density (mass per area)
+	ElementPack *W,         // [output 1x1] Gravitational potential energy
+	ElementPack *f,         // [output 9x1] Gravity force vector
+	ElementPack *M)         // [output 9x9] Inertia matrix
+	;
+
 #endif
\ No newline at end of file
@@ -1,311 +1,315 @@
+#include "ComputeMembrane.h"
+
 #include <cmath>
-void ComputeMembrane(
-   const double *xa, // [input 3x1] World position of vertex A
-   const double *xb, // [input 3x1] World position of vertex B
-   const double *xc, // [input 3x1] World position of vertex C
-   const double *Xa, // [input 2x1] Material position of vertex A
-   const double *Xb, // [input 2x1] Material position of vertex B
-   const double *Xc, // [input 2x1] Material position of vertex C
-   double e,         // [input 1x1] Young's modulus -pascals
-   double nu,        // [input 1x1] Poisson's ratio 0.3 or 0.2
-   const double *P,  // [input 2x3] Projection matrix (column major)
-   const double *Q,  // [input 2x2] Polar decomposition of \bar{F} (column major)
-   double *W,        // [output 1x1] Membrane potential energy
-   double *f,        // [output 9x1] Membrane force vector
-   double *K)        // [output 9x9] Membrane stiffness matrix
+// T is double for a single element, or an ElementPack for one element per lane
+template <typename T>
+static void ComputeMembraneT(
+   const T *xa, // [input 3x1] World position of vertex A
+   const T *xb, // [input 3x1] World position of vertex B
+   const T *xc, // [input 3x1] World position of vertex C
+   const T *Xa, // [input 2x1] Material position of vertex A
+   const T *Xb, // [input 2x1] Material position of vertex B
+   const T *Xc, // [input 2x1] Material position of vertex C
+   const T &e,  // [input 1x1] Young's modulus -pascals
+   const T &nu, // [input 1x1] Poisson's ratio 0.3 or 0.2
+   const T *P,  // [input 2x3] Projection matrix (column major)
+   const T *Q,  // [input 2x2] Polar decomposition of \bar{F} (column major)
+   T *W,        // [output 1x1] Membrane potential energy
+   T *f,        // [output 9x1] Membrane force vector
+   T *K)        // [output 9x9] Membrane stiffness matrix
 {
-double xax = xa[0];
-double xay = xa[1];
-double xaz = xa[2];
-double xbx = xb[0];
-double xby = xb[1];
-double xbz = xb[2];
-double xcx = xc[0];
-double xcy = xc[1];
-double xcz = xc[2];
-double Xax = Xa[0];
-double Xay = Xa[1];
-double Xbx = Xb[0];
-double Xby = Xb[1];
-double Xcx = Xc[0];
-double Xcy = Xc[1];
+T xax = xa[0];
+T xay = xa[1];
+T xaz = xa[2];
+T xbx = xb[0];
+T xby = xb[1];
+T xbz = xb[2];
+T xcx = xc[0];
+T xcy = xc[1];
+T xcz = xc[2];
+T Xax = Xa[0];
+T Xay = Xa[1];
+T Xbx = Xb[0];
+T Xby = Xb[1];
+T Xcx = Xc[0];
+T Xcy = Xc[1];
 // P and Q are stored as column-major matrices
-double P00 = P[0];
-double P10 = P[1];
-double P01 = P[2];
-double P11 = P[3];
-double P02 = P[4];
-double P12 = P[5];
-double Q00 = Q[0];
-double Q10 = Q[1];
-double Q01 = Q[2];
-double Q11 = Q[3];
-double t7 = Xax * Xby - Xax * Xcy - Xbx * Xay + Xcx * Xay + Xbx * Xcy - Xcx * Xby;
-double t8 = t7 / 2;
-double t9 = 1 + nu;
-double t12 = e / t9 / 2;
-double t15 = P00 * Q00 + P10 * Q10;
-double t17 = 0.1e1 / t7;
-double t18 = (xbx - xax) * t17;
-double t19 = Xcy - Xay;
-double t22 = (xcx - xax) * t17;
-double t23 = -Xby + Xay;
-double t25 = t18 * t19 + t22 * t23;
-double t26 = t15 * t25;
-double t29 = P01 * Q00 + P11 * Q10;
-double t31 = (xby - xay) * t17;
-double t34 = (xcy - xay) * t17;
-double t36 = t31 * t19 + t34 * t23;
-double t37 = t29 * t36;
-double t40 = P02 * Q00 + P12 * Q10;
-double t42 = (xbz - xaz) * t17;
-double t45 = (xcz - xaz) * t17;
-double t47 = t42 * t19 + t45 * t23;
-double t48 = t40 * t47;
-double t49 = t26 + t37 + t48 - 1;
-double t50 = t49 * t49;
-double t53 = P00 * Q01 + P10 * Q11;
-double t57 = P01 * Q01 + P11 * Q11;
-double t61 = P02 * Q01 + P12 * Q11;
-double t63 = t53 * t25 + t57 * t36 + t61 * t47;
-double t64 = t63 * t63;
-double t65 = -Xcx + Xax;
-double t67 = Xbx - Xax;
-double t69 = t18 * t65 + t22 * t67;
-double t73 = t31 * t65 + t34 * t67;
-double t77 = t42 * t65 + t45 * t67;
-double t79 = t15 * t69 + t29 * t73 + t40 * t77;
-double t80 = t79 * t79;
-double t81 = t53 * t69;
-double t82 = t57 * t73;
-double t83 = t61 * t77;
-double t84 = t81 + t82 + t83 - 1;
-double t85 = t84 * t84;
-double t88 = e * nu;
-double t89 = 1 / t9;
-double t92 = 1 / (1 - 2 * nu);
-double t93 = t89 * t92;
-double t94 = t26 + t37 + t48 - 2 + t81 + t82 + t83;
-double t95 = t94 * t94;
-double W00 = t8 * (t12 * (t50 + t64 + t80 + t85) + t88 * t93 * t95 / 2);
-double t100 = t49 * t15;
-double t101 = t17 * t19;
-double t102 = t17 * t23;
-double t103 = -t101 - t102;
-double t105 = t63 * t53;
-double t107 = t79 * t15;
-double t108 = t17 * t65;
-double t109 = t17 * t67;
-double t110 = -t108 - t109;
-double t112 = t84 * t53;
-double t117 = t88 * t89;
-double t118 = t92 * t94;
-double t121 = t15 * t103 + t53 * t110;
-double f01 = -t8 * (t12 * (2 * t100 * t103 + 2 * t105 * t103 + 2 * t107 * t110 + 2 * t112 * t110) + t117 * t118 * t121);
-double t126 = t49 * t29;
-double t128 = t63 * t57;
-double t130 = t79 * t29;
-double t132 = t84 * t57;
-double t139 = t29 * t103 + t57 * t110;
-double f02 = -t8 * (t12 * (2 * t126 * t103 + 2 * t128 * t103 + 2 * t130 * t110 + 2 * t132 * t110) + t117 * t118 * t139);
-double t144 = t49 * t40;
-double t146 = t63 * t61;
-double t148 = t79 * t40;
-double t150 = t84 * t61;
-double t157 = t40 * t103 + t61 * t110;
-double f03 = -t8 * (t12 * (2 * t144 * t103 + 2 * t146 * t103 + 2 * t148 * t110 + 2 * t150 * t110) + t117 * t118 * t157);
-double t169 = t15 * t17;
-double t171 = t53 * t17;
-double t173 = t169 * t19 + t171 * t65;
-double f04 = -t8 * (t12 * (2 * t100 * t101 + 2 * t105 * t101 + 2 * t107 * t108 + 2 * t112 * t108) + t117 * t118 * t173);
-double t185 = t29 * t17;
-double t187 = t57 * t17;
-double t189 = t185 * t19 + t187 * t65;
-double f05 = -t8 * (t12 * (2 * t126 * t101 + 2 * t128 * t101 + 2 * t130 * t108 + 2 * t132 * t108) + t117 * t118 * t189);
-double t201 = t40 * t17;
-double t203 = t61 * t17;
-double t205 = t201 * t19 + t203 * t65;
-double f06 = -t8 * (t12 * (2 * t144 * t101 + 2 * t146 * t101 + 2 * t148 * t108 + 2 * t150 * t108) + t117 * t118 * t205);
-double t219 = t169 * t23 + t171 * t67;
-double f07 = -t8 * (t12 * (2 * t100 * t102 + 2 * t105 * t102 + 2 * t107 * t109 + 2 * t112 * t109) + t117 * t118 * t219);
-double t233 = t185 * t23 + t187 * t67;
-double f08 = -t8 * (t12 * (2 * t126 * t102 + 2 * t128 * t102 + 2 * t130 * t109 + 2 * t132 * t109) + t117 * t118 * t233);
-double t247 = t201 * t23 + t203 * t67;
-double f09 = -t8 * (t12 * (2 * t144 * t102 + 2 * t146 * t102 + 2 * t148 * t109 + 2 * t150 * t109) + t117 * t118 * t247);
-double t252 = t15 * t15;
-double t253 = t103 * t103;
-double t255 = t53 * t53;
-double t257 = t110 * t110;
-double t263 = t121 * t121;
-double K0101 = t8 * (t12 * (2 * t252 * t253 + 2 * t252 * t257 + 2 * t255 * t253 + 2 * t255 * t257) + t88 * t93 * t263);
-double K0102 = t8 * (t12 * (2 * t29 * t253 * t15 + 2 * t29 * t257 * t15 + 2 * t57 * t253 * t53 + 2 * t57 * t257 * t53) + t117 * t92 * t139 * t121);
-double t282 = t40 * t253;
-double t284 = t61 * t253;
-double t286 = t40 * t257;
-double t288 = t61 * t257;
-double t293 = t92 * t157;
-double K0103 = t8 * (t12 * (2 * t282 * t15 + 2 * t286 * t15 + 2 * t284 * t53 + 2 * t288 * t53) + t117 * t293 * t121);
-double t297 = t252 * t17;
-double t298 = t19 * t103;
-double t300 = t255 * t17;
-double t302 = t65 * t110;
-double t308 = t92 * t173;
-double K0104 = t8 * (t12 * (2 * t297 * t298 + 2 * t297 * t302 + 2 * t300 * t298 + 2 * t300 * t302) + t117 * t308 * t121);
-double t313 = t19 * t15 * t103;
-double t316 = t19 * t53 * t103;
-double t319 = t65 * t15 * t110;
-double t322 = t65 * t53 * t110;
-double t326 = t12 * (2 * t185 * t313 + 2 * t185 * t319 + 2 * t187 * t316 + 2 * t187 * t322);
-double t327 = t92 * t189;
-double K0105 = t8 * (t117 * t327 * t121 + t326);
-double t337 = t12 * (2 * t201 * t313 + 2 * t201 * t319 + 2 * t203 * t316 + 2 * t203 * t322);
-double t338 = t92 * t205;
-double K0106 = t8 * (t117 * t338 * t121 + t337);
-double t342 = t23 * t103;
-double t345 = t67 * t110;
-double t351 = t92 * t219;
-double K0107 = t8 * (t12 * (2 * t297 * t342 + 2 * t297 * t345 + 2 * t300 * t342 + 2 * t300 * t345) + t117 * t351 * t121);
-double t355 = t23 * t15;
-double t356 = t355 * t103;
-double t358 = t23 * t53;
-double t359 = t358 * t103;
-double t361 = t67 * t15;
-double t362 = t361 * t110;
-double t364 = t67 * t53;
-double t365 = t364 * t110;
-double t369 = t12 * (2 * t185 * t356 + 2 * t185 * t362 + 2 * t187 * t359 + 2 * t187 * t365);
-double t370 = t92 * t233;
-double K0108 = t8 * (t117 * t370 * t121 + t369);
-double t380 = t12 * (2 * t201 * t356 + 2 * t201 * t362 + 2 * t203 * t359 + 2 * t203 * t365);
-double t381 = t92 * t247;
-double K0109 = t8 * (t117 * t381 * t121 + t380);
-double K0201 = K0102;
-double t385 = t29 * t29;
-double t387 = t57 * t57;
-double t394 = t139 * t139;
-double K0202 = t8 * (t12 * (2 * t385 * t253 + 2 * t387 * t253 + 2 * t385 * t257 + 2 * t387 * t257) + t88 * t93 * t394);
-double K0203 = t8 * (t12 * (2 * t282 * t29 + 2 * t284 * t57 + 2 * t286 * t29 + 2 * t288 * t57) + t117 * t293 * t139);
-double K0204 = t8 * (t117 * t308 * t139 + t326);
-double t411 = t385 * t17;
-double t413 = t387 * t17;
-double K0205 = t8 * (t12 * (2 * t411 * t298 + 2 * t413 * t298 + 2 * t411 * t302 + 2 * t413 * t302) + t117 * t327 * t139);
-double t437 = t12 * (2 * t201 * t19 * t29 * t103 + 2 * t203 * t19 * t57 * t103 + 2 * t201 * t65 * t29 * t110 + 2 * t203 * t65 * t57 * t110);
-double K0206 = t8 * (t117 * t338 * t139 + t437);
-double K0207 = t8 * (t117 * t351 * t139 + t369);
-double K0208 = t8 * (t12 * (2 * t411 * t342 + 2 * t413 * t342 + 2 * t411 * t345 + 2 * t413 * t345) + t117 * t370 * t139);
-double t454 = t23 * t29;
-double t457 = t23 * t57;
-double t460 = t67 * t29;
-double t463 = t67 * t57;
-double t468 = t12 * (2 * t201 * t454 * t103 + 2 * t203 * t457 * t103 + 2 * t201 * t460 * t110 + 2 * t203 * t463 * t110);
-double K0209 = t8 * (t117 * t381 * t139 + t468);
-double K0301 = K0103;
-double K0302 = K0203;
-double t472 = t40 * t40;
-double t474 = t61 * t61;
-double t481 = t157 * t157;
-double K0303 = t8 * (t12 * (2 * t472 * t253 + 2 * t474 * t253 + 2 * t472 * t257 + 2 * t474 * t257) + t88 * t93 * t481);
-double K0304 = t8 * (t117 * t308 * t157 + t337);
-double K0305 = t8 * (t117 * t327 * t157 + t437);
-double t491 = t472 * t17;
-double t493 = t474 * t17;
-double K0306 = t8 * (t12 * (2 * t491 * t298 + 2 * t493 * t298 + 2 * t491 * t302 + 2 * t493 * t302) + t117 * t338 * t157);
-double K0307 = t8 * (t117 * t351 * t157 + t380);
-double K0308 = t8 * (t117 * t370 * t157 + t468);
-double K0309 = t8 * (t12 * (2 * t491 * t342 + 2 * t493 * t342 + 2 * t491 * t345 + 2 * t493 * t345) + t117 * t381 * t157);
-double K0401 = K0104;
-double K0402 = K0204;
-double K0403 = K0304;
-double t519 = t7 * t7;
-double t520 = 0.1e1 / t519;
-double t521 = t252 * t520;
-double t522 = t19 * t19;
-double t524 = t255 * t520;
-double t526 = t65 * t65;
-double t532 = t173 * t173;
-double K0404 = t8 * (t12 * (2 * t521 * t522 + 2 * t521 * t526 + 2 * t524 * t522 + 2 * t524 * t526) + t88 * t93 * t532);
-double t536 = t29 * t520;
-double t537 = t522 * t15;
-double t539 = t57 * t520;
-double t540 = t522 * t53;
-double t542 = t526 * t15;
-double t544 = t526 * t53;
-double K0405 = t8 * (t12 * (2 * t536 * t537 + 2 * t536 * t542 + 2 * t539 * t540 + 2 * t539 * t544) + t117 * t327 * t173);
-double t552 = t40 * t520;
-double t554 = t61 * t520;
-double K0406 = t8 * (t12 * (2 * t552 * t537 + 2 * t554 * t540 + 2 * t552 * t542 + 2 * t554 * t544) + t117 * t338 * t173);
-double t564 = t23 * t19;
-double t567 = t67 * t65;
-double K0407 = t8 * (t12 * (2 * t521 * t564 + 2 * t521 * t567 + 2 * t524 * t564 + 2 * t524 * t567) + t117 * t351 * t173);
-double t576 = t355 * t19;
-double t578 = t358 * t19;
-double t580 = t361 * t65;
-double t582 = t364 * t65;
-double t586 = t12 * (2 * t536 * t576 + 2 * t536 * t580 + 2 * t539 * t578 + 2 * t539 * t582);
-double K0408 = t8 * (t117 * t370 * t173 + t586);
-double t596 = t12 * (2 * t552 * t576 + 2 * t552 * t580 + 2 * t554 * t578 + 2 * t554 * t582);
-double K0409 = t8 * (t117 * t381 * t173 + t596);
-double K0501 = K0105;
-double K0502 = K0205;
-double K0503 = K0305;
-double K0504 = K0405;
-double t600 = t385 * t520;
-double t602 = t387 * t520;
-double t609 = t189 * t189;
-double K0505 = t8 * (t12 * (2 * t600 * t522 + 2 * t602 * t522 + 2 * t600 * t526 + 2 * t602 * t526) + t88 * t93 * t609);
-double K0506 = t8 * (t12 * (2 * t552 * t522 * t29 + 2 * t552 * t526 * t29 + 2 * t554 * t522 * t57 + 2 * t554 * t526 * t57) + t117 * t338 * t189);
-double K0507 = t8 * (t117 * t351 * t189 + t586);
-double K0508 = t8 * (t12 * (2 * t600 * t564 + 2 * t602 * t564 + 2 * t600 * t567 + 2 * t602 * t567) + t117 * t370 * t189);
-double t650 = t12 * (2 * t552 * t454 * t19 + 2 * t554 * t457 * t19 + 2 * t552 * t460 * t65 + 2 * t554 * t463 * t65);
-double K0509 = t8 * (t117 * t381 * t189 + t650);
-double K0601 = K0106;
-double K0602 = K0206;
-double K0603 = K0306;
-double K0604 = K0406;
-double K0605 = K0506;
-double t654 = t472 * t520;
-double t656 = t474 * t520;
-double t663 = t205 * t205;
-double K0606 = t8 * (t12 * (2 * t654 * t522 + 2 * t656 * t522 + 2 * t654 * t526 + 2 * t656 * t526) + t88 * t93 * t663);
-double K0607 = t8 * (t117 * t351 * t205 + t596);
-double K0608 = t8 * (t117 * t370 * t205 + t650);
-double K0609 = t8 * (t12 * (2 * t654 * t564 + 2 * t656 * t564 + 2 * t654 * t567 + 2 * t656 * t567) + t117 * t381 * t205);
-double K0701 = K0107;
-double K0702 = K0207;
-double K0703 = K0307;
-double K0704 = K0407;
-double K0705 = K0507;
-double K0706 = K0607;
-double t683 = t23 * t23;
-double t686 = t67 * t67;
-double t692 = t219 * t219;
-double K0707 = t8 * (t12 * (2 * t521 * t683 + 2 * t521 * t686 + 2 * t524 * t683 + 2 * t524 * t686) + t88 * t93 * t692);
-double t696 = t683 * t15;
-double t698 = t683 * t53;
-double t700 = t686 * t15;
-double t702 = t686 * t53;
-double K0708 = t8 * (t12 * (2 * t536 * t696 + 2 * t536 * t700 + 2 * t539 * t698 + 2 * t539 * t702) + t117 * t370 * t219);
-double K0709 = t8 * (t12 * (2 * t552 * t696 + 2 * t552 * t700 + 2 * t554 * t698 + 2 * t554 * t702) + t117 * t381 * t219);
-double K0801 = K0108;
-double K0802 = K0208;
-double K0803 = K0308;
-double K0804 = K0408;
-double K0805 = K0508;
-double K0806 = K0608;
-double K0807 = K0708;
-double t727 = t233 * t233;
-double K0808 = t8 * (t12 * (2 * t600 * t683 + 2 * t600 * t686 + 2 * t602 * t683 + 2 * t602 * t686) + t88 * t93 * t727);
-double K0809 = t8 * (t12 * (2 * t552 * t683 * t29 + 2 * t552 * t686 * t29 + 2 * t554 * t683 * t57 + 2 * t554 * t686 * t57) + t117 * t381 * t233);
-double K0901 = K0109;
-double K0902 = K0209;
-double K0903 = K0309;
-double K0904 = K0409;
-double K0905 = K0509;
-double K0906 = K0609;
-double K0907 = K0709;
-double K0908 = K0809;
-double t752 = t247 * t247;
-double K0909 = t8 * (t12 * (2 * t654 * t683 + 2 * t654 * t686 + 2 * t656 * t683 + 2 * t656 * t686) + t88 * t93 * t752);
+T P00 = P[0];
+T P10 = P[1];
+T P01 = P[2];
+T P11 = P[3];
+T P02 = P[4];
+T P12 = P[5];
+T Q00 = Q[0];
+T Q10 = Q[1];
+T Q01 = Q[2];
+T Q11 = Q[3];
+T t7 = Xax * Xby - Xax * Xcy - Xbx * Xay + Xcx * Xay + Xbx * Xcy - Xcx * Xby;
+T t8 = t7 / 2;
+T t9 = 1 + nu;
+T t12 = e / t9 / 2;
+T t15 = P00 * Q00 + P10 * Q10;
+T t17 = 0.1e1 / t7;
+T t18 = (xbx - xax) * t17;
+T t19 = Xcy - Xay;
+T t22 = (xcx - xax) * t17;
+T t23 = -Xby + Xay;
+T t25 = t18 * t19 + t22 * t23;
+T t26 = t15 * t25;
+T t29 = P01 * Q00 + P11 * Q10;
+T t31 = (xby - xay) * t17;
+T t34 = (xcy - xay) * t17;
+T t36 = t31 * t19 + t34 * t23;
+T t37 = t29 * t36;
+T t40 = P02 * Q00 + P12 * Q10;
+T t42 = (xbz - xaz) * t17;
+T t45 = (xcz - xaz) * t17;
+T t47 = t42 * t19 + t45 * t23;
+T t48 = t40 * t47;
+T t49 = t26 + t37 + t48 - 1;
+T t50 = t49 * t49;
+T t53 = P00 * Q01 + P10 * Q11;
+T t57 = P01 * Q01 + P11 * Q11;
+T t61 = P02 * Q01 + P12 * Q11;
+T t63 = t53 * t25 + t57 * t36 + t61 * t47;
+T t64 = t63 * t63;
+T t65 = -Xcx + Xax;
+T t67 = Xbx - Xax;
+T t69 = t18 * t65 + t22 * t67;
+T t73 = t31 * t65 + t34 * t67;
+T t77 = t42 * t65 + t45 * t67;
+T t79 = t15 * t69 + t29 * t73 + t40 * t77;
+T t80 = t79 * t79;
+T t81 = t53 * t69;
+T t82 = t57 * t73;
+T t83 = t61 * t77;
+T t84 = t81 + t82 + t83 - 1;
+T t85 = t84 * t84;
+T t88 = e * nu;
+T t89 = 1 / t9;
+T t92 = 1 / (1 - 2 * nu);
+T t93 = t89 * t92;
+T t94 = t26 + t37 + t48 - 2 + t81 + t82 + t83;
+T t95 = t94 * t94;
+T W00 = t8 * (t12 * (t50 + t64 + t80 + t85) + t88 * t93 * t95 / 2);
+T t100 = t49 * t15;
+T t101 = t17 * t19;
+T t102 = t17 * t23;
+T t103 = -t101 - t102;
+T t105 = t63 * t53;
+T t107 = t79 * t15;
+T t108 = t17 * t65;
+T t109 = t17 * t67;
+T t110 = -t108 - t109;
+T t112 = t84 * t53;
+T t117 = t88 * t89;
+T t118 = t92 * t94;
+T t121 = t15 * t103 + t53 * t110;
+T f01 = -t8 * (t12 * (2 * t100 * t103 + 2 * t105 * t103 + 2 * t107 * t110 + 2 * t112 * t110) + t117 * t118 * t121);
+T t126 = t49 * t29;
+T t128 = t63 * t57;
+T t130 = t79 * t29;
+T t132 = t84 * t57;
+T t139 = t29 * t103 + t57 * t110;
+T f02 = -t8 * (t12 * (2 * t126 * t103 + 2 * t128 * t103 + 2 * t130 * t110 + 2 * t132 * t110) + t117 * t118 * t139);
+T t144 = t49 * t40;
+T t146 = t63 * t61;
+T t148 = t79 * t40;
+T t150 = t84 * t61;
+T t157 = t40 * t103 + t61 * t110;
+T f03 = -t8 * (t12 * (2 * t144 * t103 + 2 * t146 * t103 + 2 * t148 * t110 + 2 * t150 * t110) + t117 * t118 * t157);
+T t169 = t15 * t17;
+T t171 = t53 * t17;
+T t173 = t169 * t19 + t171 * t65;
+T f04 = -t8 * (t12 * (2 * t100 * t101 + 2 * t105 * t101 + 2 * t107 * t108 + 2 * t112 * t108) + t117 * t118 * t173);
+T t185 = t29 * t17;
+T t187 = t57 * t17;
+T t189 = t185 * t19 + t187 * t65;
+T f05 = -t8 * (t12 * (2 * t126 * t101 + 2 * t128 * t101 + 2 * t130 * t108 + 2 * t132 * t108) + t117 * t118 * t189);
+T t201 = t40 * t17;
+T t203 = t61 * t17;
+T t205 = t201 * t19 + t203 * t65;
+T f06 = -t8 * (t12 * (2 * t144 * t101 + 2 * t146 * t101 + 2 * t148 * t108 + 2 * t150 * t108) + t117 * t118 * t205);
+T t219 = t169 * t23 + t171 * t67;
+T f07 = -t8 * (t12 * (2 * t100 * t102 + 2 * t105 * t102 + 2 * t107 * t109 + 2 * t112 * t109) + t117 * t118 * t219);
+T t233 = t185 * t23 + t187 * t67;
+T f08 = -t8 * (t12 * (2 * t126 * t102 + 2 * t128 * t102 + 2 * t130 * t109 + 2 * t132 * t109) + t117 * t118 * t233);
+T t247 = t201 * t23 + t203 * t67;
+T f09 = -t8 * (t12 * (2 * t144 * t102 + 2 * t146 * t102 + 2 * t148 * t109 + 2 * t150 * t109) + t117 * t118 * t247);
+T t252 = t15 * t15;
+T t253 = t103 * t103;
+T t255 = t53 * t53;
+T t257 = t110 * t110;
+T t263 = t121 * t121;
+T K0101 = t8 * (t12 * (2 * t252 * t253 + 2 * t252 * t257 + 2 * t255 * t253 + 2 * t255 * t257) + t88 * t93 * t263);
+T K0102 = t8 * (t12 * (2 * t29 * t253 * t15 + 2 * t29 * t257 * t15 + 2 * t57 * t253 * t53 + 2 * t57 * t257 * t53) + t117 * t92 * t139 * t121);
+T t282 = t40 * t253;
+T t284 = t61 * t253;
+T t286 = t40 * t257;
+T t288 = t61 * t257;
+T t293 = t92 * t157;
+T K0103 = t8 * (t12 * (2 * t282 * t15 + 2 * t286 * t15 + 2 * t284 * t53 + 2 * t288 * t53) + t117 * t293 * t121);
+T t297 = t252 * t17;
+T t298 = t19 * t103;
+T t300 = t255 * t17;
+T t302 = t65 * t110;
+T t308 = t92 * t173;
+T K0104 = t8 * (t12 * (2 * t297 * t298 + 2 * t297 * t302 + 2 * t300 * t298 + 2 * t300 * t302) + t117 * t308 * t121);
+T t313 = t19 * t15 * t103;
+T t316 = t19 * t53 * t103;
+T t319 = t65 * t15 * t110;
+T t322 = t65 * t53 * t110;
+T t326 = t12 * (2 * t185 * t313 + 2 * t185 * t319 + 2 * t187 * t316 + 2 * t187 * t322);
+T t327 = t92 * t189;
+T K0105 = t8 * (t117 * t327 * t121 + t326);
+T t337 = t12 * (2 * t201 * t313 + 2 * t201 * t319 + 2 * t203 * t316 + 2 * t203 * t322);
+T t338 = t92 * t205;
+T K0106 = t8 * (t117 * t338 * t121 + t337);
+T t342 = t23 * t103;
+T t345 = t67 * t110;
+T t351 = t92 * t219;
+T K0107 = t8 * (t12 * (2 * t297 * t342 + 2 * t297 * t345 + 2 * t300 * t342 + 2 * t300 * t345) + t117 * t351 * t121);
+T t355 = t23 * t15;
+T t356 = t355 * t103;
+T t358 = t23 * t53;
+T t359 = t358 * t103;
+T t361 = t67 * t15;
+T t362 = t361 * t110;
+T t364 = t67 * t53;
+T t365 = t364 * t110;
+T t369 = t12 * (2 * t185 * t356 + 2 * t185 * t362 + 2 * t187 * t359 + 2 * t187 * t365);
+T t370 = t92 * t233;
+T K0108 = t8 * (t117 * t370 * t121 + t369);
+T t380 = t12 * (2 * t201 * t356 + 2 * t201 * t362 + 2 * t203 * t359 + 2 * t203 * t365);
+T t381 = t92 * t247;
+T K0109 = t8 * (t117 * t381 * t121 + t380);
+T K0201 = K0102;
+T t385 = t29 * t29;
+T t387 = t57 * t57;
+T t394 = t139 * t139;
+T K0202 = t8 * (t12 * (2 * t385 * t253 + 2 * t387 * t253 + 2 * t385 * t257 + 2 * t387 * t257) + t88 * t93 * t394);
+T K0203 = t8 * (t12 * (2 * t282 * t29 + 2 * t284 * t57 + 2 * t286 * t29 + 2 * t288 * t57) + t117 * t293 * t139);
+T K0204 = t8 * (t117 * t308 * t139 + t326);
+T t411 = t385 * t17;
+T t413 = t387 * t17;
+T K0205 = t8 * (t12 * (2 * t411 * t298 + 2 * t413 * t298 + 2 * t411 * t302 + 2 * t413 * t302) + t117 * t327 * t139);
+T t437 = t12 * (2 * t201 * t19 * t29 * t103 + 2 * t203 * t19 * t57 * t103 + 2 * t201 * t65 * t29 * t110 + 2 * t203 * t65 * t57 * t110);
+T K0206 = t8 * (t117 * t338 * t139 + t437);
+T K0207 = t8 * (t117 * t351 * t139 + t369);
+T K0208 = t8 * (t12 * (2 * t411 * t342 + 2 * t413 * t342 + 2 * t411 * t345 + 2 * t413 * t345) + t117 * t370 * t139);
+T t454 = t23 * t29;
+T t457 = t23 * t57;
+T t460 = t67 * t29;
+T t463 = t67 * t57;
+T t468 = t12 * (2 * t201 * t454 * t103 + 2 * t203 * t457 * t103 + 2 * t201 * t460 * t110 + 2 * t203 * t463 * t110);
+T K0209 = t8 * (t117 * t381 * t139 + t468);
+T K0301 = K0103;
+T K0302 = K0203;
+T t472 = t40 * t40;
+T t474 = t61 * t61;
+T t481 = t157 * t157;
+T K0303 = t8 * (t12 * (2 * t472 * t253 + 2 * t474 * t253 + 2 * t472 * t257 + 2 * t474 * t257) + t88 * t93 * t481);
+T K0304 = t8 * (t117 * t308 * t157 + t337);
+T K0305 = t8 * (t117 * t327 * t157 + t437);
+T t491 = t472 * t17;
+T t493 = t474 * t17;
+T K0306 = t8 * (t12 * (2 * t491 * t298 + 2 * t493 * t298 + 2 * t491 * t302 + 2 * t493 * t302) + t117 * t338 * t157);
+T K0307 = t8 * (t117 * t351 * t157 + t380);
+T K0308 = t8 * (t117 * t370 * t157 + t468);
+T K0309 = t8 * (t12 * (2 * t491 * t342 + 2 * t493 * t342 + 2 * t491 * t345 + 2 * t493 * t345) + t117 * t381 * t157);
+T K0401 = K0104;
+T K0402 = K0204;
+T K0403 = K0304;
+T t519 = t7 * t7;
+T t520 = 0.1e1 / t519;
+T t521 = t252 * t520;
+T t522 = t19 * t19;
+T t524 = t255 * t520;
+T t526 = t65 * t65;
+T t532 = t173 * t173;
+T K0404 = t8 * (t12 * (2 * t521 * t522 + 2 * t521 * t526 + 2 * t524 * t522 + 2 * t524 * t526) + t88 * t93 * t532);
+T t536 = t29 * t520;
+T t537 = t522 * t15;
+T t539 = t57 * t520;
+T t540 = t522 * t53;
+T t542 = t526 * t15;
+T t544 = t526 * t53;
+T K0405 = t8 * (t12 * (2 * t536 * t537 + 2 * t536 * t542 + 2 * t539 * t540 + 2 * t539 * t544) + t117 * t327 * t173);
+T t552 = t40 * t520;
+T t554 = t61 * t520;
+T K0406 = t8 * (t12 * (2 * t552 * t537 + 2 * t554 * t540 + 2 * t552 * t542 + 2 * t554 * t544) + t117 * t338 * t173);
+T t564 = t23 * t19;
+T t567 = t67 * t65;
+T K0407 = t8 * (t12 * (2 * t521 * t564 + 2 * t521 * t567 + 2 * t524 * t564 + 2 * t524 * t567) + t117 * t351 * t173);
+T t576 = t355 * t19;
+T t578 = t358 * t19;
+T t580 = t361 * t65;
+T t582 = t364 * t65;
+T t586 = t12 * (2 * t536 * t576 + 2 * t536 * t580 + 2 * t539 * t578 + 2 * t539 * t582);
+T K0408 = t8 * (t117 * t370 * t173 + t586);
+T t596 = t12 * (2 * t552 * t576 + 2 * t552 * t580 + 2 * t554 * t578 + 2 * t554 * t582);
+T K0409 = t8 * (t117 * t381 * t173 + t596);
+T K0501 = K0105;
+T K0502 = K0205;
+T K0503 = K0305;
+T K0504 = K0405;
+T t600 = t385 * t520;
+T t602 = t387 * t520;
+T t609 = t189 * t189;
+T K0505 = t8 * (t12 * (2 * t600 * t522 + 2 * t602 * t522 + 2 * t600 * t526 + 2 * t602 * t526) + t88 * t93 * t609);
+T K0506 = t8 * (t12 * (2 * t552 * t522 * t29 + 2 * t552 * t526 * t29 + 2 * t554 * t522 * t57 + 2 * t554 * t526 * t57) + t117 * t338 * t189);
+T K0507 = t8 * (t117 * t351 * t189 + t586);
+T K0508 = t8 * (t12 * (2 * t600 * t564 + 2 * t602 * t564 + 2 * t600 * t567 + 2 * t602 * t567) + t117 * t370 * t189);
+T t650 = t12 * (2 * t552 * t454 * t19 + 2 * t554 * t457 * t19 + 2 * t552 * t460 * t65 + 2 * t554 * t463 * t65);
+T K0509 = t8 * (t117 * t381 * t189 + t650);
+T K0601 = K0106;
+T K0602 = K0206;
+T K0603 = K0306;
+T K0604 = K0406;
+T K0605 = K0506;
+T t654 = t472 * t520;
+T t656 = t474 * t520;
+T t663 = t205 * t205;
+T K0606 = t8 * (t12 * (2 * t654 * t522 + 2 * t656 * t522 + 2 * t654 * t526 + 2 * t656 * t526) + t88 * t93 * t663);
+T K0607 = t8 * (t117 * t351 * t205 + t596);
+T K0608 = t8 * (t117 * t370 * t205 + t650);
+T K0609 = t8 * (t12 * (2 * t654 * t564 + 2 * t656 * t564 + 2 * t654 * t567 + 2 * t656 * t567) + t117 * t381 * t205);
+T K0701 = K0107;
+T K0702 = K0207;
+T K0703 = K0307;
+T K0704 = K0407;
+T K0705 = K0507;
+T K0706 = K0607;
+T t683 = t23 * t23;
+T t686 = t67 * t67;
+T t692 = t219 * t219;
+T K0707 = t8 * (t12 * (2 * t521 * t683 + 2 * t521 * t686 + 2 * t524 * t683 + 2 * t524 * t686) + t88 * t93 * t692);
+T t696 = t683 * t15;
+T t698 = t683 * t53;
+T t700 = t686 * t15;
+T t702 = t686 * t53;
+T K0708 = t8 * (t12 * (2 * t536 * t696 + 2 * t536 * t700 + 2 * t539 * t698 + 2 * t539 * t702) + t117 * t370 * t219);
+T K0709 = t8 * (t12 * (2 * t552 * t696 + 2 * t552 * t700 + 2 * t554 * t698 + 2 * t554 * t702) + t117 * t381 * t219);
+T K0801 = K0108;
+T K0802 = K0208;
+T K0803 = K0308;
+T K0804 = K0408;
+T K0805 = K0508;
+T K0806 = K0608;
+T K0807 = K0708;
+T t727 = t233 * t233;
+T K0808 = t8 * (t12 * (2 * t600 * t683 + 2 * t600 * t686 + 2 * t602 * t683 + 2 * t602 * t686) + t88 * t93 * t727);
+T K0809 = t8 * (t12 * (2 * t552 * t683 * t29 + 2 * t552 * t686 * t29 + 2 * t554 * t683 * t57 + 2 * t554 * t686 * t57) + t117 * t381 * t233);
+T K0901 = K0109;
+T K0902 = K0209;
+T K0903 = K0309;
+T K0904 = K0409;
+T K0905 = K0509;
+T K0906 = K0609;
+T K0907 = K0709;
+T K0908 = K0809;
+T t752 = t247 * t247;
+T K0909 = t8 * (t12 * (2 * t654 * t683 + 2 * t654 * t686 + 2 * t656 * t683 + 2 * t656 * t686) + t88 * t93 * t752);
 W[0]=W00;
 f[0]=f01; f[1]=f02; f[2]=f03; f[3]=f04; f[4]=f05; f[5]=f06; f[6]=f07; f[7]=f08; f[8]=f09; 
 K[ 0*9+ 0]=K0101; K[ 0*9+ 1]=K0102; K[ 0*9+ 2]=K0103; K[ 0*9+ 3]=K0104; K[ 0*9+ 4]=K0105; K[ 0*9+ 5]=K0106; K[ 0*9+ 6]=K0107; K[ 0*9+ 7]=K0108; K[ 0*9+ 8]=K0109; 
@@ -318,3 +322,13 @@ K[ 6*9+ 0]=K0701; K[ 6*9+ 1]=K0702; K[ 6*9+ 2]=K0703; K[ 6*9+ 3]=K0704; K[ 6*9+
 K[ 7*9+ 0]=K0801; K[ 7*9+ 1]=K0802; K[ 7*9+ 2]=K0803; K[ 7*9+ 3]=K0804; K[ 7*9+ 4]=K0805; K[ 7*9+ 5]=K0806; K[ 7*9+ 6]=K0807; K[ 7*9+ 7]=K0808; K[ 7*9+ 8]=K0809; 
 K[ 8*9+ 0]=K0901; K[ 8*9+ 1]=K0902; K[ 8*9+ 2]=K0903; K[ 8*9+ 3]=K0904; K[ 8*9+ 4]=K0905; K[ 8*9+ 5]=K0906; K[ 8*9+ 6]=K0907; K[ 8*9+ 7]=K0908; K[ 8*9+ 8]=K0909; 
 }
+
+void ComputeMembrane(const double *xa, const double *xb, const double *xc, const double *Xa, const double *Xb, const double *Xc, double e, double nu, const double *P, const double *Q, double *W, double *f, double *K)
+{
+	ComputeMembraneT(xa, xb, xc, Xa, Xb, Xc, e, nu, P, Q, W, f, K);
+}
+
+void ComputeMembrane(const ElementPack *xa, const ElementPack *xb, const ElementPack *xc, const ElementPack *Xa, const ElementPack *Xb, const ElementPack *Xc, const ElementPack &e, const ElementPack &nu, const ElementPack *P, const ElementPack *Q, ElementPack *W, ElementPack *f, ElementPack *K)
+{
+	ComputeMembraneT(xa, xb, xc, Xa, Xb, Xc, e, nu, P, Q, W, f, K);
+}
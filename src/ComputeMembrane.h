@@ -2,6 +2,8 @@
 #ifndef __ComputeMembrane__
 #define __ComputeMembrane__
 
+#include "SimdPack.h"
+
 void ComputeMembrane(
 	const double *xa, // [input 3x1] World position of vertex A
 	const double *xb, // [input 3x1] World position of vertex B
@@ -18,4 +20,22 @@ void ComputeMembrane(
 	double *K)        // [output 9x9] Membrane stiffness matrix
 	;
 
+// Same kernel over ElementPack::Width elements at once, one element per lane
+// The arrays have the layout above with every double replaced by a pack
+void ComputeMembrane(
+	const ElementPack *xa, // [input 3x1] World position of vertex A
+	const ElementPack *xb, // [input 3x1] World position of vertex B
+	const ElementPack *xc, // [input 3x1] World position of vertex C
+	const ElementPack *Xa, // [input 2x1] Material position of vertex A
+	const ElementPack *Xb, // [input 2x1] Material position of vertex B
+	const ElementPack *Xc, // [input 2x1] Material position of vertex C
+	const ElementPack &e,  // [input 1x1] Young's modulus -pascals
+	const ElementPack &nu, // [input 1x1] Poisson's ratio 0.3 or 0.2
+	const ElementPack *P,  // [input 2x3] Projection matrix (column major)
+	const ElementPack *Q,  // [input 2x2] Polar decomposition of \bar{F} (column major)
+	ElementPack *W,        // [output 1x1] Membrane potential energy
+	ElementPack *f,        // [output 9x1] Membrane force vector
+	ElementPack *K)        // [output 9x9] Membrane stiffness matrix
+	;
+
 #endif
\ No newline at end of file
@@ -33,7 +33,8 @@ using namespace Eigen;
 
 Constraints::Constraints() :
 	hasFixed(false),
-	hasCollisions(false)
+	hasCollisions(false),
+	eliminateFixed(true)
 {
 
 }
@@ -111,8 +112,12 @@ void Constraints::updateTable(const shared_ptr<Obstacles> obs)
 
 typedef Eigen::Triplet<double> T;
 
-void addFixed(const VectorXd& c, vector<T>& Aeq_, vector< pair<int, double> >& beq_, const double& v, const int& ci, const int& i, int& eqsize)
+void addFixed(const VectorXd& c, vector<T>& Aeq_, vector< pair<int, double> >& beq_, vector< pair<int, double> >* pinned, const double& v, const int& ci, const int& i, int& eqsize)
 {
+	if (pinned != NULL) {
+		pinned->push_back(make_pair(ci, (1 - 0.01) * v + c(i + 3)));
+		return;
+	}
 	Aeq_.push_back(T(eqsize, ci, c(i)));
 	beq_.push_back(make_pair(eqsize, (1 - 0.01) * v + c(i + 3)));
 	eqsize++;
@@ -419,49 +424,50 @@ void Constraints::fill(const Mesh& mesh, const shared_ptr<Obstacles> obs, const
 	// - We need to detect Cloth-vert to Box-face collisions post remeshing
 	// - If we run a non EOL simulation we want our constraints to be based on remeshed geometry,
 	// - We want to revert parts of EOL simulation to traditional LAG
-	vector<shared_ptr<btc::Collision> > clsLAG;
+	clsLAG.clear();
 	CD2(mesh, obs, clsLAG);
+	const VectorXi& EoLs = obs->cmesh->EoLs;
 	for (int i = 0; i < clsLAG.size(); i++) {
-		if (clsLAG[i]->count1 == 3 && clsLAG[i]->count2 == 1) {
-			if (mesh.nodes[clsLAG[i]->verts2(0)]->EoL) continue;
-			Aineq_.push_back(T(ineqsize, clsLAG[i]->verts2(0) * 3, -clsLAG[i]->nor1(0)));
-			Aineq_.push_back(T(ineqsize, clsLAG[i]->verts2(0) * 3 + 1, -clsLAG[i]->nor1(1)));
-			Aineq_.push_back(T(ineqsize, clsLAG[i]->verts2(0) * 3 + 2, -clsLAG[i]->nor1(2)));
+		if (clsLAG[i].count1 == 3 && clsLAG[i].count2 == 1) {
+			if (EoLs(clsLAG[i].verts2(0))) continue;
+			Aineq_.push_back(T(ineqsize, clsLAG[i].verts2(0) * 3, -clsLAG[i].nor1(0)));
+			Aineq_.push_back(T(ineqsize, clsLAG[i].verts2(0) * 3 + 1, -clsLAG[i].nor1(1)));
+			Aineq_.push_back(T(ineqsize, clsLAG[i].verts2(0) * 3 + 2, -clsLAG[i].nor1(2)));
 			if (online) {
-				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i]->pos2(0), clsLAG[i]->nor1(0)));
-				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i]->pos2(1), clsLAG[i]->nor1(1)));
-				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i]->pos2(2), clsLAG[i]->nor1(2)));
+				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i].pos2(0), clsLAG[i].nor1(0)));
+				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i].pos2(1), clsLAG[i].nor1(1)));
+				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i].pos2(2), clsLAG[i].nor1(2)));
 			}
 			ineqsize++;
 		}
-		else if (clsLAG[i]->count1 == 2 && clsLAG[i]->count2 == 2) {
-			if (mesh.nodes[clsLAG[i]->verts2(0)]->EoL ||
-				mesh.nodes[clsLAG[i]->verts2(1)]->EoL) continue;
+		else if (clsLAG[i].count1 == 2 && clsLAG[i].count2 == 2) {
+			if (EoLs(clsLAG[i].verts2(0)) ||
+				EoLs(clsLAG[i].verts2(1))) continue;
 			for (int j = 0; j < 2; j++) {
-				Aineq_.push_back(T(ineqsize, clsLAG[i]->verts2(j) * 3, -clsLAG[i]->nor2(0) * clsLAG[i]->weights2(j)));
-				Aineq_.push_back(T(ineqsize, clsLAG[i]->verts2(j) * 3 + 1, -clsLAG[i]->nor2(1) * clsLAG[i]->weights2(j)));
-				Aineq_.push_back(T(ineqsize, clsLAG[i]->verts2(j) * 3 + 2, -clsLAG[i]->nor2(2) * clsLAG[i]->weights2(j)));
+				Aineq_.push_back(T(ineqsize, clsLAG[i].verts2(j) * 3, -clsLAG[i].nor2(0) * clsLAG[i].weights2(j)));
+				Aineq_.push_back(T(ineqsize, clsLAG[i].verts2(j) * 3 + 1, -clsLAG[i].nor2(1) * clsLAG[i].weights2(j)));
+				Aineq_.push_back(T(ineqsize, clsLAG[i].verts2(j) * 3 + 2, -clsLAG[i].nor2(2) * clsLAG[i].weights2(j)));
 			}
 			if (online) {
-				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i]->pos2(0), clsLAG[i]->nor1(0)));
-				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i]->pos2(1), clsLAG[i]->nor1(1)));
-				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i]->pos2(2), clsLAG[i]->nor1(2)));
+				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i].pos2(0), clsLAG[i].nor1(0)));
+				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i].pos2(1), clsLAG[i].nor1(1)));
+				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i].pos2(2), clsLAG[i].nor1(2)));
 			}
 			ineqsize++;
 		}
-		else if (clsLAG[i]->count1 == 1 && clsLAG[i]->count2 == 3) {
-			if (mesh.nodes[clsLAG[i]->verts2(0)]->EoL ||
-				mesh.nodes[clsLAG[i]->verts2(1)]->EoL ||
-				mesh.nodes[clsLAG[i]->verts2(2)]->EoL) continue;
+		else if (clsLAG[i].count1 == 1 && clsLAG[i].count2 == 3) {
+			if (EoLs(clsLAG[i].verts2(0)) ||
+				EoLs(clsLAG[i].verts2(1)) ||
+				EoLs(clsLAG[i].verts2(2))) continue;
 			for (int j = 0; j < 3; j++) {
-				Aineq_.push_back(T(ineqsize, clsLAG[i]->verts2(j) * 3, -clsLAG[i]->nor2(0) * clsLAG[i]->weights2(j)));
-				Aineq_.push_back(T(ineqsize, clsLAG[i]->verts2(j) * 3 + 1, -clsLAG[i]->nor2(1) * clsLAG[i]->weights2(j)));
-				Aineq_.push_back(T(ineqsize, clsLAG[i]->verts2(j) * 3 + 2, -clsLAG[i]->nor2(2) * clsLAG[i]->weights2(j)));
+				Aineq_.push_back(T(ineqsize, clsLAG[i].verts2(j) * 3, -clsLAG[i].nor2(0) * clsLAG[i].weights2(j)));
+				Aineq_.push_back(T(ineqsize, clsLAG[i].verts2(j) * 3 + 1, -clsLAG[i].nor2(1) * clsLAG[i].weights2(j)));
+				Aineq_.push_back(T(ineqsize, clsLAG[i].verts2(j) * 3 + 2, -clsLAG[i].nor2(2) * clsLAG[i].weights2(j)));
 			}
 			if (online) {
-				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i]->pos2(0), clsLAG[i]->nor1(0)));
-				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i]->pos2(1), clsLAG[i]->nor1(1)));
-				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i]->pos2(2), clsLAG[i]->nor1(2)));
+				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i].pos2(0), clsLAG[i].nor1(0)));
+				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i].pos2(1), clsLAG[i].nor1(1)));
+				drawAineq.push_back(Vector3d(ineqsize, clsLAG[i].pos2(2), clsLAG[i].nor1(2)));
 			}
 			ineqsize++;
 		}
@@ -470,29 +476,31 @@ void Constraints::fill(const Mesh& mesh, const shared_ptr<Obstacles> obs, const
 	if (ineqsize > 0) hasCollisions = true;
 
 	double expoFill = 0.01;
+	pinned.clear();
+	vector< pair<int, double> >* pinnedOut = eliminateFixed ? &pinned : NULL;
 	if (fs->c1(0) != -1) {
 		hasFixed = true;
-		if (fs->c1(0) == 1.0) addFixed(fs->c1, Aeq_, beq_, mesh.nodes[fs->c1i]->v[0], fs->c1i * 3, 0, eqsize);
-		if (fs->c1(1) == 1.0) addFixed(fs->c1, Aeq_, beq_, mesh.nodes[fs->c1i]->v[1], fs->c1i * 3 + 1, 1, eqsize);
-		if (fs->c1(2) == 1.0) addFixed(fs->c1, Aeq_, beq_, mesh.nodes[fs->c1i]->v[2], fs->c1i * 3 + 2, 2, eqsize);
+		if (fs->c1(0) == 1.0) addFixed(fs->c1, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c1i]->v[0], fs->c1i * 3, 0, eqsize);
+		if (fs->c1(1) == 1.0) addFixed(fs->c1, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c1i]->v[1], fs->c1i * 3 + 1, 1, eqsize);
+		if (fs->c1(2) == 1.0) addFixed(fs->c1, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c1i]->v[2], fs->c1i * 3 + 2, 2, eqsize);
 	}
 	if (fs->c2(0) != -1) {
 		hasFixed = true;
-		if (fs->c2(0) == 1.0) addFixed(fs->c2, Aeq_, beq_, mesh.nodes[fs->c2i]->v[0], fs->c2i * 3, 0, eqsize);
-		if (fs->c2(1) == 1.0) addFixed(fs->c2, Aeq_, beq_, mesh.nodes[fs->c2i]->v[1], fs->c2i * 3 + 1, 1, eqsize);
-		if (fs->c2(2) == 1.0) addFixed(fs->c2, Aeq_, beq_, mesh.nodes[fs->c2i]->v[2], fs->c2i * 3 + 2, 2, eqsize);
+		if (fs->c2(0) == 1.0) addFixed(fs->c2, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c2i]->v[0], fs->c2i * 3, 0, eqsize);
+		if (fs->c2(1) == 1.0) addFixed(fs->c2, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c2i]->v[1], fs->c2i * 3 + 1, 1, eqsize);
+		if (fs->c2(2) == 1.0) addFixed(fs->c2, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c2i]->v[2], fs->c2i * 3 + 2, 2, eqsize);
 	}
 	if (fs->c3(0) != -1) {
 		hasFixed = true;
-		if (fs->c3(0) == 1.0) addFixed(fs->c3, Aeq_, beq_, mesh.nodes[fs->c3i]->v[0], fs->c3i * 3, 0, eqsize);
-		if (fs->c3(1) == 1.0) addFixed(fs->c3, Aeq_, beq_, mesh.nodes[fs->c3i]->v[1], fs->c3i * 3 + 1, 1, eqsize);
-		if (fs->c3(2) == 1.0) addFixed(fs->c3, Aeq_, beq_, mesh.nodes[fs->c3i]->v[2], fs->c3i * 3 + 2, 2, eqsize);
+		if (fs->c3(0) == 1.0) addFixed(fs->c3, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c3i]->v[0], fs->c3i * 3, 0, eqsize);
+		if (fs->c3(1) == 1.0) addFixed(fs->c3, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c3i]->v[1], fs->c3i * 3 + 1, 1, eqsize);
+		if (fs->c3(2) == 1.0) addFixed(fs->c3, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c3i]->v[2], fs->c3i * 3 + 2, 2, eqsize);
 	}
 	if (fs->c4(0) != -1) {
 		hasFixed = true;
-		if (fs->c4(0) == 1.0) addFixed(fs->c4, Aeq_, beq_, mesh.nodes[fs->c4i]->v[0], fs->c4i * 3, 0, eqsize);
-		if (fs->c4(1) == 1.0) addFixed(fs->c4, Aeq_, beq_, mesh.nodes[fs->c4i]->v[1], fs->c4i * 3 + 1, 1, eqsize);
-		if (fs->c4(2) == 1.0) addFixed(fs->c4, Aeq_, beq_, mesh.nodes[fs->c4i]->v[2], fs->c4i * 3 + 2, 2, eqsize);
+		if (fs->c4(0) == 1.0) addFixed(fs->c4, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c4i]->v[0], fs->c4i * 3, 0, eqsize);
+		if (fs->c4(1) == 1.0) addFixed(fs->c4, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c4i]->v[1], fs->c4i * 3 + 1, 1, eqsize);
+		if (fs->c4(2) == 1.0) addFixed(fs->c4, Aeq_, beq_, pinnedOut, mesh.nodes[fs->c4i]->v[2], fs->c4i * 3 + 2, 2, eqsize);
 	}
 
 	Aeq.resize(eqsize, mesh.nodes.size() * 3 + mesh.EoL_Count * 2);
@@ -13,6 +13,8 @@
 #include <Eigen/Sparse>
 #include <Eigen/StdVector>
 
+#include "boxTriCollision.h"
+
 #ifdef EOLC_ONLINE
 class MatrixStack;
 class Program;
@@ -42,8 +44,16 @@ public:
 	Eigen::VectorXd beq;
 	Eigen::VectorXd bineq;
 
+	// Fixed corner coordinates as (variable index, velocity)
+	// With eliminateFixed these are substituted out of the solve instead of being added as rows of Aeq
+	bool eliminateFixed;
+	std::vector<std::pair<int, double> > pinned;
+
 	Eigen::MatrixXd constraintTable;
 
+	// Post remeshing collisions from CD2, kept so its storage is reused
+	std::vector<btc::Collision> clsLAG;
+
 	void init(const std::shared_ptr<Obstacles> obs);
 	void updateTable(const std::shared_ptr<Obstacles> obs);
 	void fill(const Mesh& mesh, const std::shared_ptr<Obstacles> obs, const std::shared_ptr<FixedList> fs, double h, const bool& online);
@@ -0,0 +1,226 @@
+#include "DebugDump.h"
+#include "matlabOutputs.h"
+
+#include <iostream>
+#include <fstream>
+#include <cstdint>
+#include <chrono>
+
+using namespace std;
+using namespace Eigen;
+
+DebugDump::DebugDump() :
+	enabled(false),
+	firstFrame(0),
+	lastFrame(-1),
+	sink(DebugDump::Matlab),
+	queueSize(4),
+	prefix("solver"),
+	timings(false),
+	frame(-1),
+	writing(false),
+	stopping(false)
+{
+
+}
+
+DebugDump::~DebugDump()
+{
+	if (!writer.joinable()) return;
+	{
+		unique_lock<mutex> lk(lock);
+		stopping = true;
+	}
+	notEmpty.notify_all();
+	writer.join();
+}
+
+void DebugDump::beginFrame()
+{
+	frame++;
+	current.reset();
+	if (active()) {
+		current = make_shared<Frame>();
+		current->frame = frame;
+	}
+}
+
+bool DebugDump::active() const
+{
+	if (!enabled) return false;
+	if (frame < firstFrame) return false;
+	if (lastFrame >= 0 && frame > lastFrame) return false;
+	return true;
+}
+
+void DebugDump::endFrame()
+{
+	if (!current) return;
+	if (!writer.joinable()) writer = thread(&DebugDump::run, this);
+
+	unique_lock<mutex> lk(lock);
+	notFull.wait(lk, [this] { return (int)pending.size() < max(queueSize, 1); });
+	pending.push_back(current);
+	current.reset();
+	lk.unlock();
+	notEmpty.notify_one();
+}
+
+void DebugDump::flush()
+{
+	unique_lock<mutex> lk(lock);
+	notFull.wait(lk, [this] { return pending.empty() && !writing; });
+}
+
+DebugDump::Entry& DebugDump::newEntry(const string& name, int kind)
+{
+	current->entries.push_back(Entry());
+	Entry& e = current->entries.back();
+	e.name = name;
+	e.kind = kind;
+	return e;
+}
+
+void DebugDump::add(const string& name, double d)
+{
+	if (!current) return;
+	newEntry(name, DebugDump::Double).d = MatrixXd::Constant(1, 1, d);
+}
+
+void DebugDump::add(const string& name, const VectorXd& vec)
+{
+	if (!current) return;
+	newEntry(name, DebugDump::Vec).d = vec;
+}
+
+void DebugDump::add(const string& name, const VectorXi& vec)
+{
+	if (!current) return;
+	newEntry(name, DebugDump::VecI).i = vec;
+}
+
+void DebugDump::add(const string& name, const MatrixXd& mat)
+{
+	if (!current) return;
+	newEntry(name, DebugDump::Mat).d = mat;
+}
+
+void DebugDump::add(const string& name, const MatrixXi& mat)
+{
+	if (!current) return;
+	newEntry(name, DebugDump::MatI).i = mat;
+}
+
+void DebugDump::add(const string& name, const SparseMatrix<double>& mat)
+{
+	if (!current) return;
+	newEntry(name, DebugDump::Sparse).s = mat;
+}
+
+void DebugDump::run()
+{
+	while (true) {
+		shared_ptr<Frame> fr;
+		{
+			unique_lock<mutex> lk(lock);
+			notEmpty.wait(lk, [this] { return !pending.empty() || stopping; });
+			if (pending.empty()) return;
+			fr = pending.front();
+			pending.pop_front();
+			writing = true;
+		}
+		notFull.notify_all();
+
+		auto start = chrono::steady_clock::now();
+		if (sink == DebugDump::Binary) writeBinary(*fr);
+		else writeMatlab(*fr);
+		if (timings) {
+			long long nnz = 0, dense = 0;
+			for (int k = 0; k < fr->entries.size(); k++) {
+				nnz += fr->entries[k].s.nonZeros();
+				dense += fr->entries[k].d.size() + fr->entries[k].i.size();
+			}
+			double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+			cout << "DebugDump: frame " << fr->frame << " written in " << ms << " ms (" << nnz << " sparse non zeros, " << dense << " dense values)" << endl;
+		}
+
+		{
+			unique_lock<mutex> lk(lock);
+			writing = false;
+		}
+		notFull.notify_all();
+	}
+}
+
+void DebugDump::writeMatlab(const Frame& fr) const
+{
+	string file_name = prefix + "_" + to_string(fr.frame) + ".m";
+	for (int k = 0; k < fr.entries.size(); k++) {
+		const Entry& e = fr.entries[k];
+		bool overwrite = k == 0;
+		if (e.kind == DebugDump::Double) double_to_file(e.d(0, 0), e.name, file_name, overwrite);
+		else if (e.kind == DebugDump::Vec) vec_to_file(VectorXd(e.d), e.name, file_name, overwrite);
+		else if (e.kind == DebugDump::VecI) vec_to_file(VectorXi(e.i), e.name, file_name, overwrite);
+		else if (e.kind == DebugDump::Mat) mat_to_file(e.d, e.name, file_name, overwrite);
+		else if (e.kind == DebugDump::MatI) mat_to_file(e.i, e.name, file_name, overwrite);
+		else if (e.kind == DebugDump::Sparse) mat_s2s_file(e.s, e.name, file_name, overwrite);
+	}
+}
+
+static void write_int(ofstream& ofs, int32_t i)
+{
+	ofs.write(reinterpret_cast<const char*>(&i), sizeof(int32_t));
+}
+
+void DebugDump::writeBinary(const Frame& fr) const
+{
+	string file_name = prefix + "_" + to_string(fr.frame) + ".bin";
+	ofstream ofs(file_name, ofstream::out | ofstream::trunc | ofstream::binary);
+	if (!ofs) {
+		cout << "Could not open debug dump file " << file_name << endl;
+		return;
+	}
+
+	ofs.write("EOLD", 4);
+	write_int(ofs, 1);
+	write_int(ofs, fr.frame);
+	write_int(ofs, fr.entries.size());
+
+	for (int k = 0; k < fr.entries.size(); k++) {
+		const Entry& e = fr.entries[k];
+		write_int(ofs, e.name.size());
+		ofs.write(e.name.data(), e.name.size());
+		write_int(ofs, e.kind);
+		if (e.kind == DebugDump::Sparse) {
+			write_int(ofs, e.s.rows());
+			write_int(ofs, e.s.cols());
+			vector<int32_t> is, js;
+			vector<double> vs;
+			is.reserve(e.s.nonZeros());
+			js.reserve(e.s.nonZeros());
+			vs.reserve(e.s.nonZeros());
+			for (int c = 0; c < e.s.outerSize(); c++) {
+				for (SparseMatrix<double>::InnerIterator it(e.s, c); it; ++it) {
+					is.push_back(it.row());
+					js.push_back(it.col());
+					vs.push_back(it.value());
+				}
+			}
+			write_int(ofs, vs.size());
+			ofs.write(reinterpret_cast<const char*>(is.data()), is.size() * sizeof(int32_t));
+			ofs.write(reinterpret_cast<const char*>(js.data()), js.size() * sizeof(int32_t));
+			ofs.write(reinterpret_cast<const char*>(vs.data()), vs.size() * sizeof(double));
+		}
+		else if (e.kind == DebugDump::VecI || e.kind == DebugDump::MatI) {
+			write_int(ofs, e.i.rows());
+			write_int(ofs, e.i.cols());
+			Matrix<int32_t, Dynamic, Dynamic> i32 = e.i.cast<int32_t>();
+			ofs.write(reinterpret_cast<const char*>(i32.data()), i32.size() * sizeof(int32_t));
+		}
+		else {
+			write_int(ofs, e.d.rows());
+			write_int(ofs, e.d.cols());
+			ofs.write(reinterpret_cast<const char*>(e.d.data()), e.d.size() * sizeof(double));
+		}
+	}
+}
@@ -0,0 +1,99 @@
+#pragma once
+#ifndef __DebugDump__
+#define __DebugDump__
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#define EIGEN_DONT_ALIGN_STATICALLY
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+// Optional dump of the per step solver data for debugging outside of the simulation
+// Data added during a frame is copied into a record and written out by a background thread
+// The queue is bounded, if the writer falls behind the simulation waits rather than growing memory
+//
+// Sinks
+//	Matlab: <prefix>_<frame>.m, the same text format as matlabOutputs
+//	Binary: <prefix>_<frame>.bin, little endian raw records
+//		header: char[4] "EOLD", int32 version, int32 frame, int32 entry count
+//		entry:  int32 name length, name chars, int32 kind, int32 rows, int32 cols, payload
+//		payload for dense kinds is rows*cols column major double (int32 for integer kinds)
+//		payload for Sparse is int32 nnz, then nnz int32 rows, nnz int32 cols, nnz double values
+class DebugDump
+{
+public:
+	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+	enum Sink {
+		Matlab = 0, Binary = 1
+	};
+
+	enum Kind {
+		Double = 0, Vec = 1, VecI = 2, Mat = 3, MatI = 4, Sparse = 5
+	};
+
+	bool enabled;
+	int firstFrame;
+	int lastFrame; // Negative for no end
+	int sink;
+	int queueSize;
+	std::string prefix;
+	bool timings; // Prints the write time and size of every dumped frame
+
+	DebugDump();
+	virtual ~DebugDump();
+
+	// Starts a new frame, everything added until endFrame goes into the same file
+	void beginFrame();
+	void endFrame();
+	// Whether the current frame should be dumped, check before building expensive data
+	bool active() const;
+	// Blocks until everything queued has been written
+	void flush();
+
+	void add(const std::string& name, double d);
+	void add(const std::string& name, const Eigen::VectorXd& vec);
+	void add(const std::string& name, const Eigen::VectorXi& vec);
+	void add(const std::string& name, const Eigen::MatrixXd& mat);
+	void add(const std::string& name, const Eigen::MatrixXi& mat);
+	void add(const std::string& name, const Eigen::SparseMatrix<double>& mat);
+
+private:
+
+	struct Entry {
+		int kind;
+		std::string name;
+		Eigen::MatrixXd d;
+		Eigen::MatrixXi i;
+		Eigen::SparseMatrix<double> s;
+	};
+
+	struct Frame {
+		int frame;
+		std::vector<Entry> entries;
+	};
+
+	int frame;
+	std::shared_ptr<Frame> current;
+
+	std::deque<std::shared_ptr<Frame> > pending;
+	std::mutex lock;
+	std::condition_variable notEmpty;
+	std::condition_variable notFull;
+	std::thread writer;
+	bool writing;
+	bool stopping;
+
+	Entry& newEntry(const std::string& name, int kind);
+	void run();
+	void writeMatlab(const Frame& fr) const;
+	void writeBinary(const Frame& fr) const;
+};
+
+#endif
@@ -24,11 +24,48 @@
 
 #include <iostream>
 #include <utility>
+#include <thread>
+#include <algorithm>
 
 using namespace std;
 using namespace Eigen;
 
-typedef Eigen::Triplet<double> T;
+// Element vectors and matrices, with room for the 2 EoL coordinates of every node
+typedef Matrix<double, 15, 1> Vector15d;
+typedef Matrix<double, 15, 15> Matrix15d;
+typedef Matrix<double, 20, 1> Vector20d;
+typedef Matrix<double, 20, 20> Matrix20d;
+
+// Output of the element loops over one contiguous range of faces or edges
+// Forces either go straight into a force vector owned by the worker, or are logged so they can be
+// replayed in element order, which reproduces the serial summation exactly
+struct AssemblyChunk {
+	vector<BlockEntry> M_;
+	vector<BlockEntry> MDK_;
+	VectorXd* f;
+	vector<pair<int, double> > fLog;
+
+	AssemblyChunk() : f(NULL) {};
+
+	void clear()
+	{
+		M_.clear();
+		MDK_.clear();
+		fLog.clear();
+		f = NULL;
+	}
+
+	template <int N, typename Derived>
+	void addF(int index, const MatrixBase<Derived>& fe)
+	{
+		if (f != NULL) {
+			f->segment<N>(index) += fe;
+		}
+		else {
+			for (int j = 0; j < N; j++) fLog.push_back(make_pair(index + j, fe(j)));
+		}
+	}
+};
 
 Matrix2d poldec(const Matrix2d& M) {
 	double m11 = M(0, 0);
@@ -53,7 +90,28 @@ Matrix2d poldec(const Matrix2d& M) {
 
 // We are using mass lumping so the mass matrix is simplified
 
-void nodeBasedF(const Mesh& mesh, VectorXd& f, vector<T>& M_, const Vector3d& grav)
+// Adds B at the variable offsets (row, col)
+template <int R, int C>
+void addBlock(vector<BlockEntry>& A_, int row, int col, const Matrix<double, R, C>& B)
+{
+	BlockEntry e;
+	e.row = row;
+	e.col = col;
+	Map<Matrix<double, 3, 3, RowMajor> > v(e.v);
+	v.setZero();
+	v.topLeftCorner<R, C>() = B;
+	A_.push_back(e);
+}
+
+// Adds B at (i0, i1) and its transpose at (i1, i0)
+template <int R, int C>
+void addBlockPair(vector<BlockEntry>& A_, int i0, int i1, const Matrix<double, R, C>& B)
+{
+	addBlock(A_, i0, i1, B);
+	addBlock<C, R>(A_, i1, i0, B.transpose());
+}
+
+void nodeBasedF(const Mesh& mesh, VectorXd& f, vector<BlockEntry>& M_, const Vector3d& grav)
 {
 	for (int n = 0; n < mesh.nodes.size(); n++) {
 		Node* node = mesh.nodes[n];
@@ -70,120 +128,77 @@ void nodeBasedF(const Mesh& mesh, VectorXd& f, vector<T>& M_, const Vector3d& gr
 		f.segment<3>(nindex) += mg;
 
 		Matrix3d Mxx = Matrix3d::Identity() * mass;
-		for (int j = 0; j < 3; j++) {
-			M_.push_back(T(nindex + j, nindex + j, Mxx(j, j))); // We know it's a diagonal matrix
-		}
+		addBlock(M_, nindex, nindex, Mxx);
 
 		if (node->EoL) {
 			int nindexX = mesh.nodes.size() * 3 + node->EoL_index * 2;
 
-			MatrixXd F = deform_grad_v(vert);
+			Matrix3x2d F = deform_grad_v(vert);
 
 			Vector2d mFg = -mass * F.transpose() * grav;
 			f.segment<2>(nindexX) += mFg;
 
 			Matrix2d MXX = -mass * F.transpose() * F;
-			for (int j = 0; j < 2; j++) {
-				for (int k = 0; k < 2; k++) {
-					M_.push_back(T(nindexX + j, nindexX + k, MXX(j, k)));
-				}
-			}
+			addBlock(M_, nindexX, nindexX, MXX);
 
-			MatrixXd MXx = -mass * F.transpose();
-			for (int j = 0; j < 2; j++) {
-				for (int k = 0; k < 3; k++) {
-					M_.push_back(T(nindexX + j, nindex + k, MXx(j, k)));
-					M_.push_back(T(nindex + k, nindexX + j, MXx(j, k)));
-				}
-			}
+			Matrix<double, 2, 3> MXx = -mass * F.transpose();
+			addBlockPair(M_, nindexX, nindex, MXx);
 		}
 	}
 }
 
-void fillxMI(vector<T>& MDK_, vector<T>& M_, const Matrix3d& Kxx, const Matrix3d& Mxx, int index, const Vector2d& damping, double h)
+void fillxMI(vector<BlockEntry>& MDK_, vector<BlockEntry>& M_, const Matrix3d& Kxx, const Matrix3d& Mxx, int index, const Vector2d& damping, double h)
 {
 	Matrix3d MDKxx = Mxx + damping(1) * h * h * Kxx;
-	for (int j = 0; j < 3; j++) {
-		for (int k = 0; k < 3; k++) {
-			M_.push_back(T(index + j, index + k, Mxx(j, k)));
-			MDK_.push_back(T(index + j, index + k, MDKxx(j, k)));
-		}
-	}
+	addBlock(M_, index, index, Mxx);
+	addBlock(MDK_, index, index, MDKxx);
 }
 
-void fillxxMI(vector<T>& MDK_, vector<T>& M_, const Matrix3d& Kxx, const Matrix3d& Mxx, int i0, int i1, const Vector2d& damping, double h)
+void fillxxMI(vector<BlockEntry>& MDK_, vector<BlockEntry>& M_, const Matrix3d& Kxx, const Matrix3d& Mxx, int i0, int i1, const Vector2d& damping, double h)
 {
 	Matrix3d MDKxx = Mxx + damping(1) * h * h * Kxx;
-	for (int j = 0; j < 3; j++) {
-		for (int k = 0; k < 3; k++) {
-			M_.push_back(T(i0 + j, i1 + k, Mxx(j, k)));
-			M_.push_back(T(i1 + k, i0 + j, Mxx(j, k)));
-			MDK_.push_back(T(i0 + j, i1 + k, MDKxx(j, k)));
-			MDK_.push_back(T(i1 + k, i0 + j, MDKxx(j, k)));
-		}
-	}
+	addBlockPair(M_, i0, i1, Mxx);
+	addBlockPair(MDK_, i0, i1, MDKxx);
 }
 
-void fillXMI(vector<T>& MDK_, vector<T>& M_, const Matrix2d& KXX, const Matrix2d& Mxx, int index, const Vector2d& damping, double h)
+void fillXMI(vector<BlockEntry>& MDK_, vector<BlockEntry>& M_, const Matrix2d& KXX, const Matrix2d& Mxx, int index, const Vector2d& damping, double h)
 {
 	Matrix2d MDKXX = Mxx + damping(1) * h * h * KXX;
-	for (int j = 0; j < 2; j++) {
-		for (int k = 0; k < 2; k++) {
-			M_.push_back(T(index + j, index + k, Mxx(j, k)));
-			MDK_.push_back(T(index + j, index + k, MDKXX(j, k)));
-		}
-	}
+	addBlock(M_, index, index, Mxx);
+	addBlock(MDK_, index, index, MDKXX);
 }
 
-void fillXXMI(vector<T>& MDK_, vector<T>& M_, const Matrix2d& KXX, const Matrix2d& Mxx, int i0, int i1, const Vector2d& damping, double h)
+void fillXXMI(vector<BlockEntry>& MDK_, vector<BlockEntry>& M_, const Matrix2d& KXX, const Matrix2d& Mxx, int i0, int i1, const Vector2d& damping, double h)
 {
 	Matrix2d MDKXX = Mxx + damping(1) * h * h * KXX;
-	for (int j = 0; j < 2; j++) {
-		for (int k = 0; k < 2; k++) {
-			M_.push_back(T(i0 + j, i1 + k, Mxx(j, k)));
-			M_.push_back(T(i1 + k, i0 + j, Mxx(j, k)));
-			MDK_.push_back(T(i0 + j, i1 + k, MDKXX(j, k)));
-			MDK_.push_back(T(i1 + k, i0 + j, MDKXX(j, k)));
-		}
-	}
+	addBlockPair(M_, i0, i1, Mxx);
+	addBlockPair(MDK_, i0, i1, MDKXX);
 }
 
-void fillXxMI(vector<T>& MDK_, vector<T>& M_, MatrixXd& KXx, const MatrixXd& Mxx, int i0, int i1, Vector2d& damping, double h)
+void fillXxMI(vector<BlockEntry>& MDK_, vector<BlockEntry>& M_, const Matrix<double, 2, 3>& KXx, const Matrix<double, 2, 3>& Mxx, int i0, int i1, const Vector2d& damping, double h)
 {
-	MatrixXd MDKXx = Mxx + damping(1) * h * h * KXx;
-	for (int j = 0; j < 2; j++) {
-		for (int k = 0; k < 3; k++) {
-			M_.push_back(T(i0 + j, i1 + k, Mxx(j, k)));
-			M_.push_back(T(i1 + k, i0 + j, Mxx(j, k)));
-			MDK_.push_back(T(i0 + j, i1 + k, MDKXx(j, k)));
-			MDK_.push_back(T(i1 + k, i0 + j, MDKXx(j, k)));
-		}
-	}
+	Matrix<double, 2, 3> MDKXx = Mxx + damping(1) * h * h * KXx;
+	addBlockPair(M_, i0, i1, Mxx);
+	addBlockPair(MDK_, i0, i1, MDKXx);
 }
 
-void fillxXMI(vector<T>& MDK_, vector<T>& M_, MatrixXd& KxX, const MatrixXd& Mxx, int i0, int i1, Vector2d& damping, double h)
+void fillxXMI(vector<BlockEntry>& MDK_, vector<BlockEntry>& M_, const Matrix3x2d& KxX, const Matrix3x2d& Mxx, int i0, int i1, const Vector2d& damping, double h)
 {
-	MatrixXd MDKxX = Mxx + damping(1) * h * h * KxX;
-	for (int j = 0; j < 3; j++) {
-		for (int k = 0; k < 2; k++) {
-			M_.push_back(T(i0 + j, i1 + k, Mxx(j, k)));
-			M_.push_back(T(i1 + k, i0 + j, Mxx(j, k)));
-			MDK_.push_back(T(i0 + j, i1 + k, MDKxX(j, k)));
-			MDK_.push_back(T(i1 + k, i0 + j, MDKxX(j, k)));
-		}
-	}
+	Matrix3x2d MDKxX = Mxx + damping(1) * h * h * KxX;
+	addBlockPair(M_, i0, i1, Mxx);
+	addBlockPair(MDK_, i0, i1, MDKxX);
 }
 
-void fillEOLInertia(const Face* face, VectorXd& fi, MatrixXd& Mi)
+void fillEOLInertia(const Face* face, Vector15d& fi, Matrix15d& Mi)
 {
-	MatrixXd Fa, Fb, Fc;
+	Matrix3x2d Fa, Fb, Fc;
 	bool EOLA = face->v[0]->node->EoL; bool EOLB = face->v[1]->node->EoL; bool EOLC = face->v[2]->node->EoL;
 
 	//if (EOLA) Fa = deform_grad_v(face->v[0]);
 	//if (EOLB) Fb = deform_grad_v(face->v[1]);
 	//if (EOLC) Fc = deform_grad_v(face->v[2]);
 
-	MatrixXd F = deform_grad(face);
+	Matrix3x2d F = deform_grad(face);
 	if (EOLA) Fa = F;
 	if (EOLB) Fb = F;
 	if (EOLC) Fc = F;
@@ -251,16 +266,16 @@ void fillEOLInertia(const Face* face, VectorXd& fi, MatrixXd& Mi)
 	}
 }
 
-void fillEOLMembrane(const Face* face, VectorXd& fm, MatrixXd& Km)
+void fillEOLMembrane(const Face* face, Vector15d& fm, Matrix15d& Km)
 {
-	MatrixXd Fa, Fb, Fc;
+	Matrix3x2d Fa, Fb, Fc;
 	bool EOLA = face->v[0]->node->EoL; bool EOLB = face->v[1]->node->EoL; bool EOLC = face->v[2]->node->EoL;
 
 	//if (EOLA) Fa = deform_grad_v(face->v[0]);
 	//if (EOLB) Fb = deform_grad_v(face->v[1]);
 	//if (EOLC) Fc = deform_grad_v(face->v[2]);
 
-	MatrixXd F = deform_grad(face);
+	Matrix3x2d F = deform_grad(face);
 	if (EOLA) Fa = F;
 	if (EOLB) Fb = F;
 	if (EOLC) Fc = F;
@@ -328,15 +343,21 @@ void fillEOLMembrane(const Face* face, VectorXd& fm, MatrixXd& Km)
 	}
 }
 
-void faceBasedF(const Mesh& mesh, VectorXd& f, vector<T>& MDK_, vector<T>& M_, const Vector3d& grav, double h)
+// Membrane and inertia kernel inputs and outputs, one face per lane
+struct FaceBatch {
+	ElementPack xa[3], xb[3], xc[3];
+	ElementPack Xa[2], Xb[2], Xc[2];
+	ElementPack g[3], PP[6], QQ[4];
+	ElementPack e, nu, rho;
+	ElementPack Wm[1], fm[9], Km[81];
+	ElementPack Wi[1], fi[9], Mi[81];
+};
+
+// Runs the kernels on faces first to first + count - 1, lanes past count repeat the last face
+void computeFaceBatch(const Mesh& mesh, const Vector3d& grav, int first, int count, FaceBatch& b)
 {
-	for (int i = 0; i < mesh.faces.size(); i++) {
-		Face* face = mesh.faces[i];
-
-		double xa[3], xb[3], xc[3];
-		double Xa[2], Xb[2], Xc[2];
-		double g[3], PP[6], QQ[4];
-		double Wi[1], Wm[1];
+	for (int l = 0; l < ElementPack::Width; l++) {
+		Face* face = mesh.faces[first + min(l, count - 1)];
 
 		const Material* mat = face->material;
 
@@ -347,31 +368,55 @@ void faceBasedF(const Mesh& mesh, VectorXd& f, vector<T>& MDK_, vector<T>& M_, c
 			tXb = v322e(face->v[1]->u),
 			tXc = v322e(face->v[2]->u);
 
-		Map<Vector3d>(xa, 3) = txa;
-		Map<Vector3d>(xb, 3) = txb;
-		Map<Vector3d>(xc, 3) = txc;
-		Map<Vector2d>(Xa, 2) = tXa;
-		Map<Vector2d>(Xb, 2) = tXb;
-		Map<Vector2d>(Xc, 2) = tXc;
-
-		MatrixXd Dxt(3, 2);
-		MatrixXd DX(2, 2);
+		Matrix3x2d Dxt;
+		Matrix2d DX;
 		Dxt << (txb - txa), (txc - txa);
 		DX << (tXb - tXa), (tXc - tXa);
 		Vector3d normm = (txb - txa).cross(txc - txa);
 		Vector3d Pxm = (txb - txa) / (txb - txa).norm();
 		Vector3d Pym = normm.cross(Pxm);
 		Pym = Pym / Pym.norm();
-		MatrixXd Pm(2, 3);
+		Matrix<double, 2, 3> Pm;
 		Pm << Pxm.transpose(), Pym.transpose();
-		MatrixXd Fm = Dxt * DX.inverse();
+		Matrix3x2d Fm = Dxt * DX.inverse();
 		Matrix2d Fbarm = Pm*Fm;
 		Matrix2d Qm = poldec(Fbarm);
 
-		Map<MatrixXd>(PP, Pm.rows(), Pm.cols()) = Pm;
-		Map<Matrix2d>(QQ, Qm.rows(), Qm.cols()) = Qm;
+		// Pm and Qm go in column major like the single element kernels expect
+		for (int k = 0; k < 3; k++) {
+			b.xa[k][l] = txa(k);
+			b.xb[k][l] = txb(k);
+			b.xc[k][l] = txc(k);
+			b.g[k][l] = grav(k);
+		}
+		for (int k = 0; k < 2; k++) {
+			b.Xa[k][l] = tXa(k);
+			b.Xb[k][l] = tXb(k);
+			b.Xc[k][l] = tXc(k);
+		}
+		for (int k = 0; k < 6; k++) b.PP[k][l] = Pm(k);
+		for (int k = 0; k < 4; k++) b.QQ[k][l] = Qm(k);
+		b.e[l] = mat->e;
+		b.nu[l] = mat->nu;
+		b.rho[l] = mat->density;
+	}
+
+	ComputeMembrane(b.xa, b.xb, b.xc, b.Xa, b.Xb, b.Xc, b.e, b.nu, b.PP, b.QQ, b.Wm, b.fm, b.Km);
+	ComputeInertial(b.xa, b.xb, b.xc, b.Xa, b.Xb, b.Xc, b.g, b.rho, b.Wi, b.fi, b.Mi);
+}
+
+void faceBasedF(const Mesh& mesh, AssemblyChunk& out, const Vector3d& grav, double h, int first, int last)
+{
+	vector<BlockEntry>& MDK_ = out.MDK_;
+	vector<BlockEntry>& M_ = out.M_;
+	FaceBatch batch;
+	for (int i = first; i < last; i++) {
+		int lane = (i - first) % ElementPack::Width;
+		if (lane == 0) computeFaceBatch(mesh, grav, i, min(last - i, (int)ElementPack::Width), batch);
 
-		Map<Vector3d>(g, grav.rows(), grav.cols()) = grav;
+		Face* face = mesh.faces[i];
+
+		const Material* mat = face->material;
 
 		int aindex = face->v[0]->node->index * 3;
 		int bindex = face->v[1]->node->index * 3;
@@ -380,19 +425,17 @@ void faceBasedF(const Mesh& mesh, VectorXd& f, vector<T>& MDK_, vector<T>& M_, c
 		int bindexX = mesh.nodes.size() * 3 + face->v[1]->node->EoL_index * 2;
 		int cindexX = mesh.nodes.size() * 3 + face->v[2]->node->EoL_index * 2;
 
-		double fm[9], Km[81];
-		double fi[9], Mi[81];
-
-		VectorXd fme(15), fie(15);
-		MatrixXd Kme(15, 15), Mie(15, 15);
-
-		ComputeMembrane(xa, xb, xc, Xa, Xb, Xc, mat->e, mat->nu, PP, QQ, Wm, fm, Km);
-		ComputeInertial(xa, xb, xc, Xa, Xb, Xc, g, mat->density, Wi, fi, Mi);
+		Vector15d fme, fie;
+		Matrix15d Kme, Mie;
 
-		fme.segment<9>(0) = Map<VectorXd>(fm, 9);
-		Kme.block<9, 9>(0, 0) = Map<MatrixXd>(Km, 9, 9);
-		fie.segment<9>(0) = Map<VectorXd>(fi, 9);
-		Mie.block<9, 9>(0, 0) = Map<MatrixXd>(Mi, 9, 9);
+		for (int j = 0; j < 9; j++) {
+			fme(j) = batch.fm[j][lane];
+			fie(j) = batch.fi[j][lane];
+		}
+		for (int j = 0; j < 81; j++) {
+			Kme(j % 9, j / 9) = batch.Km[j][lane];
+			Mie(j % 9, j / 9) = batch.Mi[j][lane];
+		}
 
 		Vector2d damping(mat->dampingA, mat->dampingB);
 
@@ -402,14 +445,14 @@ void faceBasedF(const Mesh& mesh, VectorXd& f, vector<T>& MDK_, vector<T>& M_, c
 
 			fillEOLMembrane(face, fme, Kme);
 
-			f.segment<3>(aindex) += (fme.segment<3>(0) + fie.segment<3>(0));
-			if (face->v[0]->node->EoL) f.segment<2>(aindexX) += (fme.segment<2>(3) + fie.segment<2>(3));
+			out.addF<3>(aindex, (fme.segment<3>(0) + fie.segment<3>(0)));
+			if (face->v[0]->node->EoL) out.addF<2>(aindexX, (fme.segment<2>(3) + fie.segment<2>(3)));
 
-			f.segment<3>(bindex) += (fme.segment<3>(5) + fie.segment<3>(5));
-			if (face->v[1]->node->EoL)f.segment<2>(bindexX) += (fme.segment<2>(8) + fie.segment<2>(8));
+			out.addF<3>(bindex, (fme.segment<3>(5) + fie.segment<3>(5)));
+			if (face->v[1]->node->EoL)out.addF<2>(bindexX, (fme.segment<2>(8) + fie.segment<2>(8)));
 
-			f.segment<3>(cindex) += (fme.segment<3>(10) + fie.segment<3>(10));
-			if (face->v[2]->node->EoL) f.segment<2>(cindexX) += (fme.segment<2>(13) + fie.segment<2>(13));
+			out.addF<3>(cindex, (fme.segment<3>(10) + fie.segment<3>(10)));
+			if (face->v[2]->node->EoL) out.addF<2>(cindexX, (fme.segment<2>(13) + fie.segment<2>(13)));
 
 			// Diagonal x
 			Matrix3d Mxx, Kxx;
@@ -458,7 +501,8 @@ void faceBasedF(const Mesh& mesh, VectorXd& f, vector<T>& MDK_, vector<T>& M_, c
 			}
 
 			// X-x values
-			MatrixXd KXx, KxX, MXx, MxX;
+			Matrix<double, 2, 3> KXx, MXx;
+			Matrix3x2d KxX, MxX;
 			if (face->v[0]->node->EoL) {
 				KXx = Kme.block<2, 3>(3, 0); MXx = Mie.block<2, 3>(3, 0);
 				fillXxMI(MDK_, M_, KXx, MXx, aindexX, aindex, damping, h);
@@ -497,9 +541,9 @@ void faceBasedF(const Mesh& mesh, VectorXd& f, vector<T>& MDK_, vector<T>& M_, c
 		}
 		else {
 
-			f.segment<3>(aindex) += fme.segment<3>(0) + fie.segment<3>(0);
-			f.segment<3>(bindex) += fme.segment<3>(3) + fie.segment<3>(3);
-			f.segment<3>(cindex) += fme.segment<3>(6) + fie.segment<3>(6);
+			out.addF<3>(aindex, fme.segment<3>(0) + fie.segment<3>(0));
+			out.addF<3>(bindex, fme.segment<3>(3) + fie.segment<3>(3));
+			out.addF<3>(cindex, fme.segment<3>(6) + fie.segment<3>(6));
 
 			Matrix3d Mxx, Kxx;
 			Kxx = Kme.block<3, 3>(0, 0); Mxx = Mie.block<3, 3>(0, 0);
@@ -519,67 +563,39 @@ void faceBasedF(const Mesh& mesh, VectorXd& f, vector<T>& MDK_, vector<T>& M_, c
 	}
 }
 
-void fillxB(vector<T>& MDK_, const Matrix3d& Kxx, int index)
+void fillxB(vector<BlockEntry>& MDK_, const Matrix3d& Kxx, int index)
 {
-	for (int j = 0; j < 3; j++) {
-		for (int k = 0; k < 3; k++) {
-			MDK_.push_back(T(index + j, index + k, Kxx(j, k)));
-		}
-	}
+	addBlock(MDK_, index, index, Kxx);
 }
 
-void fillxxB(vector<T>& MDK_, const Matrix3d& Kxx, int i0, int i1)
+void fillxxB(vector<BlockEntry>& MDK_, const Matrix3d& Kxx, int i0, int i1)
 {
-	for (int j = 0; j < 3; j++) {
-		for (int k = 0; k < 3; k++) {
-			MDK_.push_back(T(i0 + j, i1 + k, Kxx(j, k)));
-			MDK_.push_back(T(i1 + k, i0 + j, Kxx(j, k)));
-		}
-	}
+	addBlockPair(MDK_, i0, i1, Kxx);
 }
 
-void fillXB(vector<T>& MDK_, const Matrix2d& KXX, int index)
+void fillXB(vector<BlockEntry>& MDK_, const Matrix2d& KXX, int index)
 {
-	for (int j = 0; j < 2; j++) {
-		for (int k = 0; k < 2; k++) {
-			MDK_.push_back(T(index + j, index + k, KXX(j, k)));
-		}
-	}
+	addBlock(MDK_, index, index, KXX);
 }
 
-void fillXXB(vector<T>& MDK_, const Matrix2d& KXX, int i0, int i1)
+void fillXXB(vector<BlockEntry>& MDK_, const Matrix2d& KXX, int i0, int i1)
 {
-	for (int j = 0; j < 2; j++) {
-		for (int k = 0; k < 2; k++) {
-			MDK_.push_back(T(i0 + j, i1 + k, KXX(j, k)));
-			MDK_.push_back(T(i1 + k, i0 + j, KXX(j, k)));
-		}
-	}
+	addBlockPair(MDK_, i0, i1, KXX);
 }
 
-void fillXxB(vector<T>& MDK_, const MatrixXd& KXx, int i0, int i1)
+void fillXxB(vector<BlockEntry>& MDK_, const Matrix<double, 2, 3>& KXx, int i0, int i1)
 {
-	for (int j = 0; j < 2; j++) {
-		for (int k = 0; k < 3; k++) {
-			MDK_.push_back(T(i0 + j, i1 + k, KXx(j, k)));
-			MDK_.push_back(T(i1 + k, i0 + j, KXx(j, k)));
-		}
-	}
+	addBlockPair(MDK_, i0, i1, KXx);
 }
 
-void fillxXB(vector<T>& MDK_, const MatrixXd& KxX, int i0, int i1)
+void fillxXB(vector<BlockEntry>& MDK_, const Matrix3x2d& KxX, int i0, int i1)
 {
-	for (int j = 0; j < 3; j++) {
-		for (int k = 0; k < 2; k++) {
-			MDK_.push_back(T(i0 + j, i1 + k, KxX(j, k)));
-			MDK_.push_back(T(i1 + k, i0 + j, KxX(j, k)));
-		}
-	}
+	addBlockPair(MDK_, i0, i1, KxX);
 }
 
-void fillEOLBending(const Edge* edge, const Vert* v0, const Vert* v1, const Vert* v2, const Vert* v3, VectorXd& fb, MatrixXd& Kb)
+void fillEOLBending(const Edge* edge, const Vert* v0, const Vert* v1, const Vert* v2, const Vert* v3, Vector20d& fb, Matrix20d& Kb)
 {
-	MatrixXd Fa, Fb, Fc, Fd;
+	Matrix3x2d Fa, Fb, Fc, Fd;
 	bool EOLA = v0->node->EoL; bool EOLB = v1->node->EoL; bool EOLC = v2->node->EoL; bool EOLD = v3->node->EoL;
 
 	//if (EOLA) Fa = deform_grad_v(v0);
@@ -587,8 +603,8 @@ void fillEOLBending(const Edge* edge, const Vert* v0, const Vert* v1, const Vert
 	//if (EOLC) Fc = deform_grad_v(v2);
 	//if (EOLD) Fd = deform_grad_v(v3);
 
-	MatrixXd F1 = deform_grad(edge->adjf[0]);
-	MatrixXd F2 = deform_grad(edge->adjf[1]);
+	Matrix3x2d F1 = deform_grad(edge->adjf[0]);
+	Matrix3x2d F2 = deform_grad(edge->adjf[1]);
 
 	if (EOLA) Fa = (F1 + F2) / 2;
 	if (EOLB) Fb = (F1 + F2) / 2;
@@ -597,10 +613,10 @@ void fillEOLBending(const Edge* edge, const Vert* v0, const Vert* v1, const Vert
 
 	Vector3d fba = fb.segment<3>(0); Vector3d fbb = fb.segment<3>(3); Vector3d fbc = fb.segment<3>(6); Vector3d fbd = fb.segment<3>(9);
 
-	Matrix3d Kbaa = Kb.block<3, 3>(0, 0); Matrix3d Kbab = Kb.block<3, 3>(0, 3); Matrix3d Kbac = Kb.block<3, 3>(0, 6); MatrixXd Kbad = Kb.block<3, 3>(0, 9);
-	Matrix3d Kbba = Kb.block<3, 3>(3, 0); Matrix3d Kbbb = Kb.block<3, 3>(3, 3); Matrix3d Kbbc = Kb.block<3, 3>(3, 6); MatrixXd Kbbd = Kb.block<3, 3>(3, 9);
-	Matrix3d Kbca = Kb.block<3, 3>(6, 0); Matrix3d Kbcb = Kb.block<3, 3>(6, 3); Matrix3d Kbcc = Kb.block<3, 3>(6, 6); MatrixXd Kbcd = Kb.block<3, 3>(6, 9);
-	Matrix3d Kbda = Kb.block<3, 3>(9, 0); Matrix3d Kbdb = Kb.block<3, 3>(9, 3); Matrix3d Kbdc = Kb.block<3, 3>(9, 6); MatrixXd Kbdd = Kb.block<3, 3>(9, 9);
+	Matrix3d Kbaa = Kb.block<3, 3>(0, 0); Matrix3d Kbab = Kb.block<3, 3>(0, 3); Matrix3d Kbac = Kb.block<3, 3>(0, 6); Matrix3d Kbad = Kb.block<3, 3>(0, 9);
+	Matrix3d Kbba = Kb.block<3, 3>(3, 0); Matrix3d Kbbb = Kb.block<3, 3>(3, 3); Matrix3d Kbbc = Kb.block<3, 3>(3, 6); Matrix3d Kbbd = Kb.block<3, 3>(3, 9);
+	Matrix3d Kbca = Kb.block<3, 3>(6, 0); Matrix3d Kbcb = Kb.block<3, 3>(6, 3); Matrix3d Kbcc = Kb.block<3, 3>(6, 6); Matrix3d Kbcd = Kb.block<3, 3>(6, 9);
+	Matrix3d Kbda = Kb.block<3, 3>(9, 0); Matrix3d Kbdb = Kb.block<3, 3>(9, 3); Matrix3d Kbdc = Kb.block<3, 3>(9, 6); Matrix3d Kbdd = Kb.block<3, 3>(9, 9);
 
 	int ja = 0; int jA = 3; int jb = 5; int jB = 8; int jc = 10; int jC = 13; int jd = 15; int jD = 18;
 
@@ -682,13 +698,30 @@ void fillEOLBending(const Edge* edge, const Vert* v0, const Vert* v1, const Vert
 	}
 }
 
-void edgeBasedF(const Mesh& mesh, const Material& mat, VectorXd& f, vector<T>& MDK_, double h)
+// Bending kernel inputs and outputs, one interior edge per lane
+struct EdgeBatch {
+	ElementPack xa[3], xb[3], xc[3], xd[3];
+	ElementPack Xa[2], Xb[2], Xc[2], Xd[2];
+	ElementPack beta;
+	ElementPack Wb[1], fb[12], Kb[144];
+};
+
+// Runs the kernel on the next interior edges from first on, stopping before last
+// Returns how many edges were taken, lanes past that repeat the last one
+int computeEdgeBatch(const Mesh& mesh, const Material& mat, int first, int last, EdgeBatch& b)
 {
-	for (int e = 0; e < mesh.edges.size(); e++) {
+	Edge* edges[ElementPack::Width];
+	int count = 0;
+	for (int e = first; e < last && count < ElementPack::Width; e++) {
 		if (mesh.edges[e]->adjf[0] == NULL || mesh.edges[e]->adjf[1] == NULL) {
 			continue;
 		}
-		Edge* edge = mesh.edges[e];
+		edges[count++] = mesh.edges[e];
+	}
+	if (count == 0) return 0;
+
+	for (int l = 0; l < ElementPack::Width; l++) {
+		Edge* edge = edges[min(l, count - 1)];
 		Face* f0 = edge->adjf[0], *f1 = edge->adjf[1];
 		Node* n0 = edge->n[0], *n1 = edge->n[1];
 		Vert* v0 = n0->verts[0], *v1 = n1->verts[0];
@@ -696,26 +729,46 @@ void edgeBasedF(const Mesh& mesh, const Material& mat, VectorXd& f, vector<T>& M
 		Vert* v2 = get_other_vert(f0, v0, v1), *v3 = get_other_vert(f1, v0, v1);
 		Node* n2 = v2->node, *n3 = v3->node;
 
-		double xa[3], xb[3], xc[3], xd[3];
-		double Xa[2], Xb[2], Xc[2], Xd[2];
-
-		Vector3d txa = v2e(n0->x),
-			txb = v2e(n1->x),
-			txc = v2e(n2->x),
-			txd = v2e(n3->x);
-		Vector2d tXa = v322e(v0->u),
-			tXb = v322e(v1->u),
-			tXc = v322e(v2->u),
-			tXd = v322e(v3->u);
-
-		Map<Vector3d>(xa, 3) = txa;
-		Map<Vector3d>(xb, 3) = txb;
-		Map<Vector3d>(xc, 3) = txc;
-		Map<Vector3d>(xd, 3) = txd;
-		Map<Vector2d>(Xa, 2) = tXa;
-		Map<Vector2d>(Xb, 2) = tXb;
-		Map<Vector2d>(Xc, 2) = tXc;
-		Map<Vector2d>(Xd, 2) = tXd;
+		for (int k = 0; k < 3; k++) {
+			b.xa[k][l] = n0->x[k];
+			b.xb[k][l] = n1->x[k];
+			b.xc[k][l] = n2->x[k];
+			b.xd[k][l] = n3->x[k];
+		}
+		for (int k = 0; k < 2; k++) {
+			b.Xa[k][l] = v0->u[k];
+			b.Xb[k][l] = v1->u[k];
+			b.Xc[k][l] = v2->u[k];
+			b.Xd[k][l] = v3->u[k];
+		}
+	}
+	b.beta = mat.beta;
+
+	ComputeBending(b.xa, b.xb, b.xc, b.xd, b.Xa, b.Xb, b.Xc, b.Xd, b.beta, b.Wb, b.fb, b.Kb);
+	return count;
+}
+
+void edgeBasedF(const Mesh& mesh, const Material& mat, AssemblyChunk& out, double h, int first, int last)
+{
+	vector<BlockEntry>& MDK_ = out.MDK_;
+	EdgeBatch batch;
+	int lane = 0, count = 0;
+	for (int e = first; e < last; e++) {
+		if (mesh.edges[e]->adjf[0] == NULL || mesh.edges[e]->adjf[1] == NULL) {
+			continue;
+		}
+		if (lane == count) {
+			count = computeEdgeBatch(mesh, mat, e, last, batch);
+			lane = 0;
+		}
+
+		Edge* edge = mesh.edges[e];
+		Face* f0 = edge->adjf[0], *f1 = edge->adjf[1];
+		Node* n0 = edge->n[0], *n1 = edge->n[1];
+		Vert* v0 = n0->verts[0], *v1 = n1->verts[0];
+
+		Vert* v2 = get_other_vert(f0, v0, v1), *v3 = get_other_vert(f1, v0, v1);
+		Node* n2 = v2->node, *n3 = v3->node;
 
 		bool to_eolA = n0->EoL;
 		bool to_eolB = n1->EoL;
@@ -731,33 +784,30 @@ void edgeBasedF(const Mesh& mesh, const Material& mat, VectorXd& f, vector<T>& M
 		int cindexX = mesh.nodes.size() * 3 + n2->EoL_index * 2;
 		int dindexX = mesh.nodes.size() * 3 + n3->EoL_index * 2;
 
-		double Wb[1], fb[12], Kb[144];
-
 		Vector2d damping(mat.dampingA, mat.dampingB);
 
-		VectorXd fbe(20);
-		MatrixXd Kbe(20, 20);
+		Vector20d fbe;
+		Matrix20d Kbe;
 
-		ComputeBending(xa, xb, xc, xd, Xa, Xb, Xc, Xd, mat.beta, Wb, fb, Kb);
-
-		fbe.segment<12>(0) = Map<VectorXd>(fb, 12);
-		Kbe.block<12, 12>(0, 0) = Map<MatrixXd>(Kb, 12, 12);
+		for (int j = 0; j < 12; j++) fbe(j) = batch.fb[j][lane];
+		for (int j = 0; j < 144; j++) Kbe(j % 12, j / 12) = batch.Kb[j][lane];
+		lane++;
 
 		if (to_eolA || to_eolB || to_eolC || to_eolD) {
 
 			fillEOLBending(edge, v0, v1, v2, v3, fbe, Kbe);
 			
-			f.segment<3>(aindex) += fbe.segment<3>(0);
-			if (to_eolA) f.segment<2>(aindexX) += fbe.segment<2>(3);
+			out.addF<3>(aindex, fbe.segment<3>(0));
+			if (to_eolA) out.addF<2>(aindexX, fbe.segment<2>(3));
 
-			f.segment<3>(bindex) += fbe.segment<3>(5);
-			if (to_eolB) f.segment<2>(bindexX) += fbe.segment<2>(8);
+			out.addF<3>(bindex, fbe.segment<3>(5));
+			if (to_eolB) out.addF<2>(bindexX, fbe.segment<2>(8));
 
-			f.segment<3>(cindex) += fbe.segment<3>(10);
-			if (to_eolC) f.segment<2>(cindexX) += fbe.segment<2>(13);
+			out.addF<3>(cindex, fbe.segment<3>(10));
+			if (to_eolC) out.addF<2>(cindexX, fbe.segment<2>(13));
 
-			f.segment<3>(dindex) += fbe.segment<3>(15);
-			if (to_eolD) f.segment<2>(dindexX) += fbe.segment<2>(18);
+			out.addF<3>(dindex, fbe.segment<3>(15));
+			if (to_eolD) out.addF<2>(dindexX, fbe.segment<2>(18));
 
 			Matrix3d Kxx;
 			Kxx = damping(1) * h * h * Kbe.block<3, 3>(0, 0);
@@ -825,7 +875,8 @@ void edgeBasedF(const Mesh& mesh, const Material& mat, VectorXd& f, vector<T>& M
 				fillXXB(MDK_, KXX, cindexX, dindexX);
 			}
 
-			MatrixXd KXx, KxX;
+			Matrix<double, 2, 3> KXx;
+			Matrix3x2d KxX;
 			if (to_eolA) {
 				KXx = damping(1) * h * h * Kbe.block<2, 3>(3, 0);
 				fillXxB(MDK_, KXx, aindexX, aindex);
@@ -911,22 +962,99 @@ void edgeBasedF(const Mesh& mesh, const Material& mat, VectorXd& f, vector<T>& M
 
 void Forces::fill(const Mesh& mesh, const Material& mat, const Vector3d& grav, double h)
 {
-	f.resize(mesh.nodes.size() * 3 + mesh.EoL_Count * 2);
+	int ndof = mesh.nodes.size() * 3 + mesh.EoL_Count * 2;
+	f.resize(ndof);
 	f.setZero();
-	vector<T> M_;
-	vector<T> MDK_;
 
 	EoL_cutoff = mesh.nodes.size() * 3;
 
-	//nodeBasedF(mesh, f, M_, grav);
-	faceBasedF(mesh, f, MDK_, M_, grav, h);
-	edgeBasedF(mesh, mat, f, MDK_, h);
+	int nthreads = threads > 0 ? threads : max((int)thread::hardware_concurrency(), 1);
+	nthreads = max(min(nthreads, (int)mesh.faces.size()), 1);
+
+	// Each worker gets one contiguous range of faces and one of edges
+	// The chunks are kept between steps so their block lists do not have to grow again
+	while (faceChunks.size() < nthreads) {
+		faceChunks.push_back(make_shared<AssemblyChunk>());
+		edgeChunks.push_back(make_shared<AssemblyChunk>());
+	}
+	fs.resize(nthreads);
+	for (int t = 0; t < nthreads; t++) {
+		faceChunks[t]->clear();
+		edgeChunks[t]->clear();
+		if (deterministic) continue;
+		if (t == 0) {
+			faceChunks[t]->f = &f;
+		}
+		else {
+			fs[t].setZero(ndof);
+			faceChunks[t]->f = &fs[t];
+		}
+		edgeChunks[t]->f = faceChunks[t]->f;
+	}
+
+	int nfaces = mesh.faces.size(), nedges = mesh.edges.size();
+	auto work = [&](int t) {
+		//nodeBasedF(mesh, f, M_, grav);
+		faceBasedF(mesh, *faceChunks[t], grav, h, (long long)nfaces * t / nthreads, (long long)nfaces * (t + 1) / nthreads);
+		edgeBasedF(mesh, mat, *edgeChunks[t], h, (long long)nedges * t / nthreads, (long long)nedges * (t + 1) / nthreads);
+	};
+	vector<thread> workers;
+	for (int t = 1; t < nthreads; t++) workers.push_back(thread(work, t));
+	work(0);
+	for (int t = 0; t < workers.size(); t++) workers[t].join();
+
+	if (deterministic) {
+		// Same order the serial loops add in, faces first then edges
+		for (int t = 0; t < nthreads; t++) {
+			for (int k = 0; k < faceChunks[t]->fLog.size(); k++) f(faceChunks[t]->fLog[k].first) += faceChunks[t]->fLog[k].second;
+		}
+		for (int t = 0; t < nthreads; t++) {
+			for (int k = 0; k < edgeChunks[t]->fLog.size(); k++) f(edgeChunks[t]->fLog[k].first) += edgeChunks[t]->fLog[k].second;
+		}
+	}
+	else {
+		for (int t = 1; t < nthreads; t++) f += fs[t];
+	}
+
+	size_t nM = 0, nMDK = 0;
+	for (int t = 0; t < nthreads; t++) {
+		nM += faceChunks[t]->M_.size();
+		nMDK += faceChunks[t]->MDK_.size() + edgeChunks[t]->MDK_.size();
+	}
 
-	M.resize(mesh.nodes.size() * 3 + mesh.EoL_Count * 2, mesh.nodes.size() * 3 + mesh.EoL_Count * 2);
-	MDK.resize(mesh.nodes.size() * 3 + mesh.EoL_Count * 2, mesh.nodes.size() * 3 + mesh.EoL_Count * 2);
+	bool relayout = Mb.setLayout(EoL_cutoff, ndof);
+	relayout = MDKb.setLayout(EoL_cutoff, ndof) || relayout;
+
+	// The block coordinates only depend on the topology and the EoL nodes, so while those are unchanged
+	// the values can be added straight into the existing blocks of M and MDK
+	if (relayout || !patternValid || Mmap.size() != nM || MDKmap.size() != nMDK) {
+		vector<BlockEntry> M_;
+		vector<BlockEntry> MDK_;
+		M_.reserve(nM);
+		MDK_.reserve(nMDK);
+		for (int t = 0; t < nthreads; t++) {
+			M_.insert(M_.end(), faceChunks[t]->M_.begin(), faceChunks[t]->M_.end());
+			MDK_.insert(MDK_.end(), faceChunks[t]->MDK_.begin(), faceChunks[t]->MDK_.end());
+		}
+		for (int t = 0; t < nthreads; t++) {
+			MDK_.insert(MDK_.end(), edgeChunks[t]->MDK_.begin(), edgeChunks[t]->MDK_.end());
+		}
+		Mb.setPattern(M_, Mmap);
+		MDKb.setPattern(MDK_, MDKmap);
+		patternValid = true;
+	}
 
-	M.setFromTriplets(M_.begin(), M_.end());
-	MDK.setFromTriplets(MDK_.begin(), MDK_.end());
+	// Blocks are taken in element order, faces first then edges, so duplicates are summed in the serial order
+	Mb.setZero();
+	MDKb.setZero();
+	size_t kM = 0, kMDK = 0;
+	for (int t = 0; t < nthreads; t++) {
+		kM = Mb.scatter(faceChunks[t]->M_, Mmap, kM);
+		kMDK = MDKb.scatter(faceChunks[t]->MDK_, MDKmap, kMDK);
+	}
+	for (int t = 0; t < nthreads; t++) {
+		kMDK = MDKb.scatter(edgeChunks[t]->MDK_, MDKmap, kMDK);
+	}
 }
 
 #ifdef EOLC_ONLINE
@@ -947,7 +1075,7 @@ void Forces::drawSimple(const Mesh &mesh, shared_ptr<MatrixStack> MV, const shar
 		glEnd();
 		if (node->EoL) {
 			int nodeEi = mesh.nodes.size() * 3 + node->EoL_index * 2;
-			MatrixXd F = deform_grad(node->verts[0]->adjf[0]);
+			Matrix3x2d F = deform_grad(node->verts[0]->adjf[0]);
 			Vector3d dF = F * f.segment<2>(nodeEi);
 			glColor3f(0.0f, 0.0f, 1.0f);
 			glBegin(GL_LINES);
@@ -7,6 +7,7 @@
 #include <string>
 
 #include "Cloth.h"
+#include "BlockSparseMatrix.h"
 
 #include "external/ArcSim/mesh.hpp"
 
@@ -22,26 +23,46 @@ class Program;
 
 //class Mesh;
 class Obstacles;
+struct AssemblyChunk;
 
 class Forces
 {
 public:
 	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
-		Forces() : EoL_cutoff(0) {};
+		Forces() : EoL_cutoff(0), threads(1), deterministic(false), patternValid(false) {}
 	virtual ~Forces() {};
 
 	Eigen::VectorXd f;
-	Eigen::SparseMatrix<double> M;
-	Eigen::SparseMatrix<double> MDK;
+	// M and MDK are assembled in node blocks, the solvers multiply through them (see BlockSystem)
+	BlockSparseMatrix Mb;
+	BlockSparseMatrix MDKb;
 
 	int EoL_cutoff;
 
+	// Worker threads for the element loops, 0 uses one per hardware thread
+	int threads;
+	// Sum the element forces in the same order as a single thread, so results do not depend on threads
+	bool deterministic;
+
 	void fill(const Mesh& mesh, const Material& mat, const Eigen::Vector3d& grav, double h);
 
+	// The block sparsity of M and MDK is reused until this is called
+	// Call it whenever the mesh topology or the set of EoL nodes changes, Mesh::topology_stamp tracks both
+	void invalidatePattern() { patternValid = false; }
+
 #ifdef EOLC_ONLINE
 	void drawSimple(const Mesh& mesh, std::shared_ptr<MatrixStack> MV, const std::shared_ptr<Program> p) const;
 #endif // EOLC_ONLINE
+
+private:
+	// Per worker element output, kept between steps
+	std::vector<std::shared_ptr<AssemblyChunk> > faceChunks, edgeChunks;
+	std::vector<Eigen::VectorXd> fs;
+
+	// Block slot in Mb and MDKb of every element block, in element order
+	bool patternValid;
+	std::vector<int> Mmap, MDKmap;
 };
 
 #endif
\ No newline at end of file
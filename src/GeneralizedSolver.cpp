@@ -1,8 +1,12 @@
 #include "GeneralizedSolver.h"
 
 #include "matlabOutputs.h"
+#include "QuadProgNative.h"
+#include "BlockPreconditioner.h"
+#include "BlockSystem.h"
 
 #include <iostream>
+#include <chrono>
 
 #ifdef EOLC_MOSEK
 #include "external/SolverWrappers/Mosek/QuadProgMosek.h"
@@ -16,7 +20,16 @@ using namespace std;
 using namespace Eigen;
 
 GeneralizedSolver::GeneralizedSolver() :
-	whichSolver(GeneralizedSolver::NoSolver)
+	whichSolver(GeneralizedSolver::NoSolver),
+	native(std::make_shared<QuadProgNative>()),
+	fastPath(true),
+	benchmarkFastPath(false),
+	cgTolerance(1e-10),
+	cgPreconditioner(GeneralizedSolver::Diagonal),
+	lagrangianSize(-1),
+	kktDelta(1e-10),
+	solveMs(0.0),
+	logTiming(false)
 {
 
 }
@@ -36,12 +49,12 @@ void generateMatlab(const SparseMatrix<double>& MDK, const VectorXd& b,
 }
 
 #ifdef EOLC_MOSEK
-bool mosekSolve(const SparseMatrix<double>& MDK, const VectorXd& b,
+// Mosek's interior point optimizer can't use a starting point, so only the program object is reused
+bool mosekSolve(QuadProgMosek* program, const SparseMatrix<double>& MDK, const VectorXd& b,
 	const SparseMatrix<double>& Aeq, const VectorXd& beq,
 	const SparseMatrix<double>& Aineq, const VectorXd& bineq,
 	VectorXd& v)
 {
-	QuadProgMosek *program = new QuadProgMosek();
 	double inf = numeric_limits<double>::infinity();
 
 	VectorXd xl;
@@ -71,13 +84,16 @@ bool mosekSolve(const SparseMatrix<double>& MDK, const VectorXd& b,
 #endif
 
 #ifdef EOLC_GUROBI
-bool gurobiSolve(SparseMatrix<double>& MDK, const VectorXd& b,
+// The model is only rebuilt when the problem size changes
+// There is no warm start, the Start attribute is only read for MIPs and the barrier ignores PStart and DStart
+bool gurobiSolve(GurobiSparse& qp, SparseMatrix<double>& MDK, const VectorXd& b,
 	SparseMatrix<double>& Aeq, const VectorXd& beq,
 	SparseMatrix<double>& Aineq, const VectorXd& bineq,
 	VectorXd& v)
 {
-	GurobiSparse qp(b.size(), beq.size(), bineq.size());
-	qp.displayOutput(false);
+	if (qp.variables() != b.size() || qp.equalities() != beq.size() || qp.inequalities() != bineq.size()) {
+		qp.problem(b.size(), beq.size(), bineq.size());
+	}
 
 	SparseMatrix<double> Sb(b.sparseView());
 	SparseVector<double> Sbeq(beq.sparseView());
@@ -105,81 +121,305 @@ bool gurobiSolve(SparseMatrix<double>& MDK, const VectorXd& b,
 #endif
 
 bool GeneralizedSolver::velocitySolve(const bool& fixedPoints, const bool& collisions,
-	SparseMatrix<double>& MDK, const VectorXd& b,
+	const BlockSparseMatrix& MDK, const VectorXd& b,
+	SparseMatrix<double>& Aeq, const VectorXd& beq,
+	SparseMatrix<double>& Aineq, const VectorXd& bineq,
+	VectorXd& v)
+{
+	if (lagrangianSize >= 0 && lagrangianSize <= b.size()) solveBlocks = BlockJacobiPreconditioner::nodeBlocks(b.size(), lagrangianSize);
+	else solveBlocks.clear();
+	return dispatch(fixedPoints, collisions,
+		BlockSystem(MDK), b,
+		Aeq, beq,
+		Aineq, bineq,
+		v);
+}
+
+bool GeneralizedSolver::dispatch(const bool& fixedPoints, const bool& collisions,
+	const BlockSystem& MDK, const VectorXd& b,
 	SparseMatrix<double>& Aeq, const VectorXd& beq,
 	SparseMatrix<double>& Aineq, const VectorXd& bineq,
 	VectorXd& v)
 {
-	//if (true) {
-	//	generateMatlab(MDK, b,
-	//		Aeq, beq,
-	//		Aineq, bineq,
-	//		v);
-	//}
-// if there are collisions, then !coll = false
-	if (!collisions && false) {
-		// Simplest case, a cloth with no fixed points and no collisions
-		if (!fixedPoints) {
-			std::cout << "in original CG Loop, fixedPoints = " << fixedPoints << std::endl;
-			ConjugateGradient<SparseMatrix<double>, Lower | Upper> cg;
-			cg.compute(MDK);
-			std::cout << "#iterations:     " << cg.iterations() << std::endl;
-			std::cout << "estimated error: " << cg.error()      << std::endl;
-			v = cg.solve(-b);
-			//cout << v << endl;
-			return true;
+	// Without collisions there are no inequalities and the QP is just a linear solve
+	bool fast = fastPath && !collisions && bineq.size() == 0;
+
+	auto start = chrono::steady_clock::now();
+	bool success;
+	if (fast && benchmarkFastPath && whichSolver != GeneralizedSolver::NoSolver) {
+		VectorXd vqp = v;
+		qpSolve(MDK, b, Aeq, beq, Aineq, bineq, vqp);
+		double qpMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		start = chrono::steady_clock::now();
+		success = fastSolve(MDK, b, Aeq, beq, v);
+		double fastMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		cout << "Fast path benchmark: QP " << qpMs << " ms, " <<
+			(beq.size() > 0 ? "KKT LDLT " : "CG ") << fastMs << " ms, " <<
+			"max velocity difference " << (v - vqp).lpNorm<Infinity>() << endl;
+	}
+	else if (fast) {
+		success = fastSolve(MDK, b, Aeq, beq, v);
+	}
+	else {
+		success = qpSolve(MDK, b, Aeq, beq, Aineq, bineq, v);
+	}
+	solveMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+	if (logTiming) {
+		cout << "Solve: " << b.size() << " variables, " << beq.size() << " equalities, " <<
+			bineq.size() << " inequalities in " << solveMs << " ms" << (fast ? " (fast path)" : "") << endl;
+	}
+	return success;
+}
+
+// Keeps the free columns of A, renumbered by freeIndex, and drops the rows left empty
+// Rows that only touched pinned variables are constant and can't be satisfied or violated by the solve
+void reduceConstraints(const SparseMatrix<double>& A, const VectorXd& bA, const VectorXi& freeIndex, int nfree, const VectorXd& vp,
+	SparseMatrix<double>& Ar, VectorXd& bAr)
+{
+	VectorXd bShift = bA - A * vp;
+	VectorXi rowIndex = VectorXi::Constant(A.rows(), -1);
+	vector<Triplet<double> > a_;
+	a_.reserve(A.nonZeros());
+	for (int k = 0; k < A.outerSize(); k++) {
+		if (freeIndex(k) < 0) continue;
+		for (SparseMatrix<double>::InnerIterator it(A, k); it; ++it) {
+			rowIndex(it.row()) = 0;
+			a_.push_back(Triplet<double>(it.row(), freeIndex(k), it.value()));
+		}
+	}
+	int rows = 0;
+	for (int i = 0; i < A.rows(); i++) {
+		if (rowIndex(i) == 0) rowIndex(i) = rows++;
+	}
+	for (int i = 0; i < a_.size(); i++) {
+		a_[i] = Triplet<double>(rowIndex(a_[i].row()), a_[i].col(), a_[i].value());
+	}
+	Ar.resize(rows, nfree);
+	Ar.setFromTriplets(a_.begin(), a_.end());
+	bAr.resize(rows);
+	for (int i = 0; i < A.rows(); i++) {
+		if (rowIndex(i) >= 0) bAr(rowIndex(i)) = bShift(i);
+	}
+}
+
+bool GeneralizedSolver::velocitySolve(const bool& fixedPoints, const bool& collisions,
+	const vector<pair<int, double> >& pinned,
+	const BlockSparseMatrix& MDK, const VectorXd& b,
+	SparseMatrix<double>& Aeq, const VectorXd& beq,
+	SparseMatrix<double>& Aineq, const VectorXd& bineq,
+	VectorXd& v)
+{
+	if (pinned.empty()) {
+		return velocitySolve(fixedPoints, collisions,
+			MDK, b,
+			Aeq, beq,
+			Aineq, bineq,
+			v);
+	}
+
+	// With v = S'*vr + vp, where S selects the free variables and vp holds the pinned values,
+	// the objective 0.5*v'*MDK*v + b'*v becomes 0.5*vr'*(S*MDK*S')*vr + vr'*S*(MDK*vp + b) plus a constant
+	// S*MDK*S' is never formed, the solvers multiply through the blocks of MDK
+	int n = b.size();
+	VectorXd vp = VectorXd::Zero(n);
+	VectorXi freeIndex = VectorXi::Zero(n);
+	for (int i = 0; i < pinned.size(); i++) {
+		vp(pinned[i].first) = pinned[i].second;
+		freeIndex(pinned[i].first) = -1;
+	}
+	int nfree = 0;
+	for (int i = 0; i < n; i++) {
+		if (freeIndex(i) == 0) freeIndex(i) = nfree++;
+	}
+
+	VectorXd bFull = MDK * vp + b;
+	VectorXd br(nfree), vr(nfree);
+	for (int i = 0; i < n; i++) {
+		if (freeIndex(i) < 0) continue;
+		br(freeIndex(i)) = bFull(i);
+		vr(freeIndex(i)) = v.size() == n ? v(i) : 0.0;
+	}
+
+	SparseMatrix<double> Aeqr, Aineqr;
+	VectorXd beqr, bineqr;
+	reduceConstraints(Aeq, beq, freeIndex, nfree, vp, Aeqr, beqr);
+	reduceConstraints(Aineq, bineq, freeIndex, nfree, vp, Aineqr, bineqr);
+
+	// A node block keeps whichever of its coordinates are still free
+	solveBlocks.clear();
+	if (lagrangianSize >= 0 && lagrangianSize <= n) {
+		vector<int> full = BlockJacobiPreconditioner::nodeBlocks(n, lagrangianSize);
+		for (int k = 0; k + 1 < full.size(); k++) {
+			for (int i = full[k]; i < full[k + 1]; i++) {
+				if (freeIndex(i) >= 0) {
+					solveBlocks.push_back(freeIndex(i));
+					break;
+				}
+			}
+		}
+		solveBlocks.push_back(nfree);
+	}
+
+	bool success = dispatch(fixedPoints, collisions && bineqr.size() > 0,
+		BlockSystem(MDK, freeIndex, nfree), br,
+		Aeqr, beqr,
+		Aineqr, bineqr,
+		vr);
+
+	v = vp;
+	for (int i = 0; i < n; i++) {
+		if (freeIndex(i) >= 0) v(i) = vr(freeIndex(i));
+	}
+	return success;
+}
+
+const char* GeneralizedSolver::preconditionerName(int which)
+{
+	if (which == BlockJacobi) return "block-Jacobi";
+	if (which == IncompleteCholesky) return "IC(0)";
+	return "diagonal";
+}
+
+template <typename CG, typename Mat>
+bool cgSolve(CG& cg, const Mat& A, const VectorXd& b, double tol, VectorXd& v)
+{
+	cg.setTolerance(tol);
+	cg.compute(A);
+	v = cg.solveWithGuess(-b, v);
+	return cg.info() == Success;
+}
+
+bool GeneralizedSolver::fastSolve(const BlockSystem& MDK, const VectorXd& b,
+	const SparseMatrix<double>& Aeq, const VectorXd& beq,
+	VectorXd& v)
+{
+	int n = b.size();
+	int m = beq.size();
+	if (v.size() != n) v.setZero(n);
+
+	// No constraints at all, MDK v = -b
+	// CG multiplies through the blocks of MDK, the diagonal preconditioner is block-Jacobi with 1x1 blocks
+	if (m == 0) {
+		cgDiagonal.preconditioner().setBlocks(vector<int>());
+		if (benchmarkFastPath && cgPreconditioner != Diagonal) {
+			VectorXd vdiag = v;
+			auto start = chrono::steady_clock::now();
+			cgSolve(cgDiagonal, MDK, b, cgTolerance, vdiag);
+			double diagMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+			cout << "Preconditioner benchmark: diagonal " << cgDiagonal.iterations() << " iterations in " << diagMs << " ms" << endl;
+		}
+		auto start = chrono::steady_clock::now();
+		bool success;
+		int iterations;
+		if (cgPreconditioner == BlockJacobi) {
+			cgBlock.preconditioner().setBlocks(solveBlocks);
+			success = cgSolve(cgBlock, MDK, b, cgTolerance, v);
+			iterations = cgBlock.iterations();
+		}
+		else if (cgPreconditioner == IncompleteCholesky) {
+			// IC(0) factors the scalar entries, so only this option assembles them
+			SparseMatrix<double> MDKs = MDK.toSparse();
+			success = cgSolve(cgIC, MDKs, b, cgTolerance, v);
+			iterations = cgIC.iterations();
 		}
 		else {
-			std::cout << "in original LSCG Loop, foxedPoints = " << fixedPoints << std::endl;
-			// If there are fixed points we can use KKT which is faster than solving a quadprog
-			// the assumption is made that MDK and b have been built properly uppon making it here
-			// LeastSquaresConjugateGradient<SparseMatrix<double> > lscg;
-			// lscg.compute(MDK);
-			// v = lscg.solve(-b);
-			// return true;
-			ConjugateGradient<SparseMatrix<double>, Lower | Upper> cg2;
-			cg2.compute(MDK);
-			std::cout << "#iterations:     " << cg2.iterations() << std::endl;
-			std::cout << "estimated error: " << cg2.error()      << std::endl;
-			v = cg2.solve(-b);
-			//cout << v << endl;
-			return true;
+			success = cgSolve(cgDiagonal, MDK, b, cgTolerance, v);
+			iterations = cgDiagonal.iterations();
 		}
+		if (benchmarkFastPath) {
+			double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+			cout << "Preconditioner benchmark: " << preconditionerName(cgPreconditioner) << " " << iterations << " iterations in " << ms << " ms" << endl;
+		}
+		if (!success) cout << "Fast path: CG did not converge in " << iterations << " iterations" << endl;
+		return success;
 	}
-	else {
-		std::cout << "** didn't even go thru the if loop of CG **"  << std::endl;
-		if (whichSolver == GeneralizedSolver::NoSolver) {
-			cout << "The simulation has encountered a collision, but a quadratic programming solver has not been specified." << endl;
-			cout << "Please either set an external quadratic programming solver, or avoid collisions in your simulation." << endl;
-			abort();
+
+	// Equality constrained, solve the KKT system
+	//    [ MDK   Aeq'   ] [ v ]   [ -b  ]
+	//    [ Aeq -delta*I ] [ y ] = [ beq ]
+	// The small -delta block makes it quasi-definite so the unpivoted LDLT is stable for any ordering,
+	// a couple of refinement steps against the exact system remove the regularization error
+	vector<Triplet<double> > kkt_;
+	kkt_.reserve(MDK.nonZeros() / 2 + n + Aeq.nonZeros() + m);
+	MDK.triplets(kkt_, true);
+	for (int k = 0; k < Aeq.outerSize(); k++) {
+		for (SparseMatrix<double>::InnerIterator it(Aeq, k); it; ++it) {
+			kkt_.push_back(Triplet<double>(n + it.row(), it.col(), it.value()));
 		}
-		else if (whichSolver == GeneralizedSolver::Mosek) {
+	}
+	for (int i = 0; i < m; i++) kkt_.push_back(Triplet<double>(n + i, n + i, -kktDelta));
+	SparseMatrix<double> KKT(n + m, n + m);
+	KKT.setFromTriplets(kkt_.begin(), kkt_.end());
+
+	kktLDLT.compute(KKT);
+	if (kktLDLT.info() != Success) {
+		cout << "Fast path: KKT factorization failed" << endl;
+		return false;
+	}
+
+	VectorXd rhs(n + m), sol(n + m), r(n + m), MDKv(n);
+	rhs << -b, beq;
+	sol = kktLDLT.solve(rhs);
+	for (int i = 0; i < 2; i++) {
+		MDK.multiply(sol.head(n), MDKv);
+		r.head(n) = rhs.head(n) - MDKv - Aeq.transpose() * sol.tail(m);
+		r.tail(m) = rhs.tail(m) - Aeq * sol.head(n);
+		sol += kktLDLT.solve(r);
+	}
+	v = sol.head(n);
+	return true;
+}
+
+bool GeneralizedSolver::qpSolve(const BlockSystem& MDK, const VectorXd& b,
+	SparseMatrix<double>& Aeq, const VectorXd& beq,
+	SparseMatrix<double>& Aineq, const VectorXd& bineq,
+	VectorXd& v)
+{
+	if (whichSolver == GeneralizedSolver::NoSolver) {
+		cout << "The simulation has encountered a collision, but a quadratic programming solver has not been specified." << endl;
+		cout << "Please either set an external quadratic programming solver, or avoid collisions in your simulation." << endl;
+		abort();
+	}
+	else if (whichSolver == GeneralizedSolver::Mosek) {
 #ifdef EOLC_MOSEK
-			bool success = mosekSolve(MDK, b,
-				Aeq, beq,
-				Aineq, bineq,
-				v);
-			return success;
+		if (!mosek) mosek = make_shared<QuadProgMosek>();
+		// The external solvers are the only ones that need MDK as a scalar matrix
+		bool success = mosekSolve(mosek.get(), MDK.toSparse(), b,
+			Aeq, beq,
+			Aineq, bineq,
+			v);
+		return success;
 #else
-			cout << "ERROR:" << endl;
-			cout << "Attempting to use the mosek solver without mosek support enabled" << endl;
-			abort();
+		cout << "ERROR:" << endl;
+		cout << "Attempting to use the mosek solver without mosek support enabled" << endl;
+		abort();
 #endif
-		}
-		else if (whichSolver == GeneralizedSolver::Gurobi) {
+	}
+	else if (whichSolver == GeneralizedSolver::Gurobi) {
 #ifdef EOLC_GUROBI
-			bool success = gurobiSolve(MDK, b,
-				Aeq, beq,
-				Aineq, bineq,
-				v);
-			return success;
+		if (!gurobi) {
+			gurobi = make_shared<GurobiSparse>();
+			gurobi->displayOutput(false);
+		}
+		SparseMatrix<double> MDKs = MDK.toSparse();
+		bool success = gurobiSolve(*gurobi, MDKs, b,
+			Aeq, beq,
+			Aineq, bineq,
+			v);
+		return success;
 #else
-			cout << "ERROR:" << endl;
-			cout << "Attempting to use the gurobi solver without gurobi support enabled" << endl;
-			abort();
+		cout << "ERROR:" << endl;
+		cout << "Attempting to use the gurobi solver without gurobi support enabled" << endl;
+		abort();
 #endif
-		}
+	}
+	else if (whichSolver == GeneralizedSolver::Native) {
+		native->blocks = solveBlocks;
+		return native->solve(MDK, b,
+			Aeq, beq,
+			Aineq, bineq,
+			v);
 	}
 
 	return false;
-}
\ No newline at end of file
+}
@@ -9,6 +9,19 @@
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
 
+#include "BlockPreconditioner.h"
+#include "BlockSystem.h"
+
+class QuadProgNative;
+
+#ifdef EOLC_MOSEK
+class QuadProgMosek;
+#endif
+
+#ifdef EOLC_GUROBI
+namespace Eigen { class GurobiSparse; }
+#endif
+
 class GeneralizedSolver
 {
 public:
@@ -18,13 +31,72 @@ public:
 	virtual ~GeneralizedSolver() {};
 
 	enum Solver {
-		NoSolver = 0, Mosek = 1, Gurobi = 2
+		NoSolver = 0, Mosek = 1, Gurobi = 2, Native = 3
 	};
 
 	int whichSolver;
 
+	// The backends are kept alive between steps so their setup is reused
+	// Only the native solver warm starts, from the duals of the fixed point rows of the last solve
+	std::shared_ptr<QuadProgNative> native;
+#ifdef EOLC_MOSEK
+	std::shared_ptr<QuadProgMosek> mosek;
+#endif
+#ifdef EOLC_GUROBI
+	std::shared_ptr<Eigen::GurobiSparse> gurobi;
+#endif
+
+	// Collision free steps skip the QP, CG when unconstrained and a KKT LDLT with equalities
+	bool fastPath;
+	bool benchmarkFastPath; // Also run the QP on fast path steps and log both timings
+	double cgTolerance;
+	int cgPreconditioner;
+
+	enum Preconditioner {
+		Diagonal = 0, BlockJacobi = 1, IncompleteCholesky = 2
+	};
+
+	// Number of leading variables that are 3x3 node blocks, the rest are 2x2 Eulerian blocks
+	// Set by the caller before each solve, -1 leaves every variable in its own block
+	int lagrangianSize;
+	double kktDelta; // Regularization of the KKT constraint block
+
+	// Wall clock time of the last velocitySolve
+	double solveMs;
+	bool logTiming;
+
 	bool velocitySolve(const bool& fixedPoints, const bool& collisions,
-		Eigen::SparseMatrix<double>& MDK, const Eigen::VectorXd& b,
+		const BlockSparseMatrix& MDK, const Eigen::VectorXd& b,
+		Eigen::SparseMatrix<double>& Aeq, const Eigen::VectorXd& beq,
+		Eigen::SparseMatrix<double>& Aineq, const Eigen::VectorXd& bineq,
+		Eigen::VectorXd& v);
+
+	// Substitutes the pinned (variable index, value) pairs out of the problem, solves the smaller system and scatters back
+	bool velocitySolve(const bool& fixedPoints, const bool& collisions,
+		const std::vector<std::pair<int, double> >& pinned,
+		const BlockSparseMatrix& MDK, const Eigen::VectorXd& b,
+		Eigen::SparseMatrix<double>& Aeq, const Eigen::VectorXd& beq,
+		Eigen::SparseMatrix<double>& Aineq, const Eigen::VectorXd& bineq,
+		Eigen::VectorXd& v);
+
+	static const char* preconditionerName(int which);
+
+private:
+	Eigen::ConjugateGradient<BlockSystem, Eigen::Lower | Eigen::Upper, BlockJacobiPreconditioner> cgDiagonal;
+	Eigen::ConjugateGradient<BlockSystem, Eigen::Lower | Eigen::Upper, BlockJacobiPreconditioner> cgBlock;
+	Eigen::ConjugateGradient<Eigen::SparseMatrix<double>, Eigen::Lower, Eigen::IncompleteCholesky<double> > cgIC;
+	std::vector<int> solveBlocks; // Preconditioner blocks of the system being solved, after any elimination
+	Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>, Eigen::Lower> kktLDLT;
+
+	bool dispatch(const bool& fixedPoints, const bool& collisions,
+		const BlockSystem& MDK, const Eigen::VectorXd& b,
+		Eigen::SparseMatrix<double>& Aeq, const Eigen::VectorXd& beq,
+		Eigen::SparseMatrix<double>& Aineq, const Eigen::VectorXd& bineq,
+		Eigen::VectorXd& v);
+	bool fastSolve(const BlockSystem& MDK, const Eigen::VectorXd& b,
+		const Eigen::SparseMatrix<double>& Aeq, const Eigen::VectorXd& beq,
+		Eigen::VectorXd& v);
+	bool qpSolve(const BlockSystem& MDK, const Eigen::VectorXd& b,
 		Eigen::SparseMatrix<double>& Aeq, const Eigen::VectorXd& beq,
 		Eigen::SparseMatrix<double>& Aineq, const Eigen::VectorXd& bineq,
 		Eigen::VectorXd& v);
@@ -0,0 +1,155 @@
+#include "MeshSnapshot.h"
+
+#include "external/ArcSim/util.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+using namespace Eigen;
+
+MeshSnapshot::MeshSnapshot() :
+	matchTol(1e-6),
+	nodeHash(1e-6)
+{
+
+}
+
+void MeshSnapshot::capture(Mesh& mesh)
+{
+	set_indices(mesh);
+
+	int nn = mesh.nodes.size();
+	u.resize(2 * nn);
+	x.resize(3 * nn);
+	v.resize(3 * nn);
+	V.resize(2 * nn);
+	EoL.resize(nn);
+	for (int n = 0; n < nn; n++) {
+		const Node* node = mesh.nodes[n];
+		const Vert* vert = node->verts[0];
+		u[2 * n] = vert->u[0];
+		u[2 * n + 1] = vert->u[1];
+		V[2 * n] = vert->v[0];
+		V[2 * n + 1] = vert->v[1];
+		for (int i = 0; i < 3; i++) {
+			x[3 * n + i] = node->x[i];
+			v[3 * n + i] = node->v[i];
+		}
+		EoL[n] = node->EoL;
+	}
+
+	int nf = mesh.faces.size();
+	faceNodes.resize(3 * nf);
+	faceAdj.resize(3 * nf);
+	for (int f = 0; f < nf; f++) {
+		const Face* face = mesh.faces[f];
+		for (int i = 0; i < 3; i++) {
+			faceNodes[3 * f + i] = face->v[i]->node->index;
+			// ArcSim keeps the edge opposite v[i] in adje[i]
+			const Edge* edge = face->adje[i];
+			const Face* other = edge->adjf[0] == face ? edge->adjf[1] : edge->adjf[0];
+			faceAdj[3 * f + i] = other ? other->index : -1;
+		}
+	}
+
+	nodeHash.cell = matchTol;
+	nodeHash.build(nn, [&](int n) { return nodeU(n); });
+	grid.access.snapshot = this;
+	grid.build(nf, [](int f) { return f; });
+}
+
+int MeshSnapshot::findNode(const Vector2d& X) const
+{
+	return nodeHash.find(Vec2(X(0), X(1)), [&](int n) { return nodeU(n); });
+}
+
+// Same arithmetic as ArcSim's get_barycentric_coords so transferred velocities match the mesh version
+Vector3d MeshSnapshot::barycentric(int f, const Vector2d& X) const
+{
+	const double *a = &u[2 * faceNode(f, 0)], *b = &u[2 * faceNode(f, 1)], *c = &u[2 * faceNode(f, 2)];
+	double v0[2] = { a[0] - c[0], a[1] - c[1] };
+	double v1[2] = { b[0] - c[0], b[1] - c[1] };
+	double v2[2] = { X(0) - c[0], X(1) - c[1] };
+	double dot00 = v0[0] * v0[0] + v0[1] * v0[1];
+	double dot01 = v0[0] * v1[0] + v0[1] * v1[1];
+	double dot02 = v0[0] * v2[0] + v0[1] * v2[1];
+	double dot11 = v1[0] * v1[0] + v1[1] * v1[1];
+	double dot12 = v1[0] * v2[0] + v1[1] * v2[1];
+	double invDenom = 1.f / (dot00 * dot11 - dot01 * dot01);
+	double bu = (dot11 * dot02 - dot01 * dot12) * invDenom;
+	double bv = (dot00 * dot12 - dot01 * dot02) * invDenom;
+	return Vector3d(bu, bv, 1 - bu - bv);
+}
+
+bool MeshSnapshot::isInside(int f, const Vector2d& X) const
+{
+	Vector3d bary = barycentric(f, X);
+	return ((bary[0] >= -10 * EPSILON) && (bary[1] >= -10 * EPSILON) && (bary[2] >= -100 * EPSILON));
+}
+
+int MeshSnapshot::enclosingFace(const Vector2d& X, int hint) const
+{
+	Vec2 u(X(0), X(1));
+	if (hint >= 0) {
+		int face = walk_to_enclosing_face(u, hint, 16, grid.access);
+		if (face >= 0) return face;
+	}
+	int face = grid.find(u);
+	if (face >= 0) return face;
+	for (int f = 0; f < numFaces(); f++)
+		if (isInside(f, X)) return f;
+
+	// Outside every face, e.g. just past the boundary, so take the face the point is least outside of
+	assert(numFaces() > 0 && "MeshSnapshot::enclosingFace: the snapshot has no faces");
+	int best = 0;
+	double bestMin = -numeric_limits<double>::infinity();
+	for (int f = 0; f < numFaces(); f++) {
+		double m = barycentric(f, X).minCoeff();
+		if (m > bestMin) {
+			bestMin = m;
+			best = f;
+		}
+	}
+	return best;
+}
+
+MatrixXd MeshSnapshot::deformGrad(int f) const
+{
+	int a = faceNode(f, 0), b = faceNode(f, 1), c = faceNode(f, 2);
+	MatrixXd Dx(3, 2);
+	for (int i = 0; i < 3; i++) {
+		Dx(i, 0) = x[3 * b + i] - x[3 * a + i];
+		Dx(i, 1) = x[3 * c + i] - x[3 * a + i];
+	}
+	Matrix2d DX;
+	DX(0, 0) = u[2 * b] - u[2 * a];
+	DX(0, 1) = u[2 * c] - u[2 * a];
+	DX(1, 0) = u[2 * b + 1] - u[2 * a + 1];
+	DX(1, 1) = u[2 * c + 1] - u[2 * a + 1];
+	return Dx * DX.inverse();
+}
+
+Vec2 SnapshotFaceAccess::corner(int f, int i) const
+{
+	int n = snapshot->faceNode(f, i);
+	return Vec2(snapshot->u[2 * n], snapshot->u[2 * n + 1]);
+}
+
+bool SnapshotFaceAccess::inside(const Vec2& u, int f) const
+{
+	return snapshot->isInside(f, Vector2d(u[0], u[1]));
+}
+
+Vec3 SnapshotFaceAccess::barycentric(const Vec2& u, int f) const
+{
+	Vector3d bary = snapshot->barycentric(f, Vector2d(u[0], u[1]));
+	return Vec3(bary(0), bary(1), bary(2));
+}
+
+int SnapshotFaceAccess::across(int f, int i) const
+{
+	return snapshot->faceAdj[3 * f + i];
+}
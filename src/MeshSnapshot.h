@@ -0,0 +1,80 @@
+#pragma once
+#ifndef __MeshSnapshot__
+#define __MeshSnapshot__
+
+#include <vector>
+#include <utility>
+
+#define EIGEN_DONT_ALIGN_STATICALLY
+#include <Eigen/Dense>
+
+#include "external/ArcSim/mesh.hpp"
+#include "external/ArcSim/facegrid.hpp"
+
+class MeshSnapshot;
+
+// Lets the material space grid and walk run on snapshot face indices
+struct SnapshotFaceAccess {
+	const MeshSnapshot* snapshot;
+
+	SnapshotFaceAccess() : snapshot(NULL) {}
+
+	int none() const { return -1; }
+	Vec2 corner(int f, int i) const;
+	bool inside(const Vec2& u, int f) const;
+	Vec3 barycentric(const Vec2& u, int f) const;
+	int across(int f, int i) const;
+};
+
+// Flat copy of the parts of the mesh the velocity transfer reads after remeshing
+// Taken instead of deep copying the ArcSim mesh, so no Verts/Nodes/Edges/Faces are allocated
+// The arrays keep their capacity from step to step
+class MeshSnapshot
+{
+public:
+	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+	MeshSnapshot();
+	virtual ~MeshSnapshot() {}
+
+	// Node data, indexed by Node::index at the time of the capture
+	std::vector<double> u; // Material coordinates, 2 per node
+	std::vector<double> x; // World positions, 3 per node
+	std::vector<double> v; // World velocities, 3 per node
+	std::vector<double> V; // Material velocities, 2 per node
+	std::vector<char> EoL;
+
+	// Face data, indexed by Face::index at the time of the capture
+	std::vector<int> faceNodes; // 3 per face
+	std::vector<int> faceAdj; // 3 per face, the face across the edge opposite each corner or -1
+
+	// Nodes closer than this in material space are considered the same node
+	double matchTol;
+
+	void capture(Mesh& mesh);
+
+	int numNodes() const { return EoL.size(); }
+	int numFaces() const { return faceNodes.size() / 3; }
+
+	// Index of a node within matchTol of X, or -1
+	int findNode(const Eigen::Vector2d& X) const;
+	// Face containing X, or the nearest face when X is outside them all. The hint is walked from first when given
+	int enclosingFace(const Eigen::Vector2d& X, int hint = -1) const;
+
+	Eigen::Vector3d barycentric(int f, const Eigen::Vector2d& X) const;
+	bool isInside(int f, const Eigen::Vector2d& X) const;
+	Eigen::MatrixXd deformGrad(int f) const;
+
+	int faceNode(int f, int i) const { return faceNodes[3 * f + i]; }
+	bool nodeEoL(int n) const { return EoL[n] != 0; }
+	Eigen::Vector3d nodeVelocity(int n) const { return Eigen::Vector3d(v[3 * n], v[3 * n + 1], v[3 * n + 2]); }
+	Eigen::Vector2d nodeMaterialVelocity(int n) const { return Eigen::Vector2d(V[2 * n], V[2 * n + 1]); }
+
+private:
+	MaterialHash nodeHash;
+	MaterialGrid<int, SnapshotFaceAccess> grid;
+
+	Vec2 nodeU(int n) const { return Vec2(u[2 * n], u[2 * n + 1]); }
+};
+
+#endif
@@ -2,6 +2,7 @@
 #include "Points.h"
 #include "Box.h"
 #include "Shape.h"
+#include "Collisions.h"
 
 #ifdef EOLC_ONLINE
 #include "online/MatrixStack.h"
@@ -12,9 +13,12 @@ using namespace std;
 using namespace Eigen;
 
 Obstacles::Obstacles() : 
-	num_boxes(0)
+	num_boxes(0),
+	cdseed(1),
+	threads(1)
 {
 	points = std::make_shared<Points>();
+	cmesh = std::make_shared<CollisionMesh>();
 }
 
 void Obstacles::load(const std::string &RESOURCE_DIR)
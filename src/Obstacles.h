@@ -13,6 +13,7 @@
 class Points;
 class Box;
 class Shape;
+class CollisionMesh;
 
 #ifdef EOLC_ONLINE
 class MatrixStack;
@@ -29,10 +30,17 @@ public:
 
 	int num_boxes;
 	double cdthreshold;
+	// Seed of the small deterministic jitter added to the cloth verts before collision detection
+	int cdseed;
+	// Worker threads for the point and box collision queries, 0 uses one per hardware thread
+	int threads;
 	std::shared_ptr<Points> points;
 	std::vector<std::shared_ptr<Box> > boxes;
 	std::vector<std::shared_ptr<Shape> > shapes;
 
+	// Cloth geometry for the collision queries shared by CD and CD2
+	std::shared_ptr<CollisionMesh> cmesh;
+
 	void load(const std::string &RESOURCE_DIR);
 	void step(double h);
 
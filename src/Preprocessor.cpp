@@ -9,6 +9,8 @@
 #include "external/ArcSim/subset.hpp"
 
 #include <stdlib.h>
+#include <map>
+#include <set>
 
 using namespace std;
 using namespace Eigen;
@@ -16,6 +18,8 @@ using namespace Eigen;
 double thresh = 0.025; // TODO:: Move
 double boundary = 0.025; // TODO:: Move;
 
+int preserveEvals = 0;
+
 Vert *adjacent_vert(const Node *node, const Vert *vert);
 
 double linepoint(const Vec3 &A, const Vec3 &B, const Vec3 &P)
@@ -42,9 +46,9 @@ double linePointDist(const Vector3d &A, const Vector3d &B, const Vector3d &P) {
 }
 
 void markWasEOL(Mesh& mesh) {
-	for (int n = 0; n < mesh.nodes.size(); n++) {
-		if (mesh.nodes[n]->EoL) {
-			mesh.nodes[n]->EoL_state = Node::WasEOL;
+	for (set<Node*>::iterator it = mesh.EoL_adjacency.begin(); it != mesh.EoL_adjacency.end(); ++it) {
+		if ((*it)->EoL) {
+			(*it)->EoL_state = Node::WasEOL;
 		}
 	}
 }
@@ -130,41 +134,41 @@ bool inBoundary(const MatrixXd &bounds, const Node* node, const double &brange)
 	return false;
 }
 
-void addGeometry(Mesh& mesh, const MatrixXd &boundaries, const vector<shared_ptr<btc::Collision> > cls)
+void addGeometry(Mesh& mesh, const MatrixXd &boundaries, const vector<btc::Collision> &cls)
 {
 	for (int i = 0; i < cls.size(); i++) {
 		// EOL nodes will be detected here
 		// If they aren't found then the EOL node has been lifted off and we need to take note
-		if (cls[i]->count1 == 3 && cls[i]->count2 == 1) {
-			Node* node = mesh.nodes[cls[i]->verts2(0)];
+		if (cls[i].count1 == 3 && cls[i].count2 == 1) {
+			Node* node = mesh.nodes[cls[i].verts2(0)];
 			if (node->EoL) {
 				node->EoL_state = Node::IsEOL;
 			}
 		}
-		else if (cls[i]->count1 == 1 && cls[i]->count2 == 3) {
-			if ((mesh.nodes[cls[i]->verts2(0)]->EoL && mesh.nodes[cls[i]->verts2(0)]->cornerID == cls[i]->verts1(0)) ||
-				(mesh.nodes[cls[i]->verts2(1)]->EoL && mesh.nodes[cls[i]->verts2(1)]->cornerID == cls[i]->verts1(0)) ||
-				(mesh.nodes[cls[i]->verts2(2)]->EoL && mesh.nodes[cls[i]->verts2(2)]->cornerID == cls[i]->verts1(0))) continue;
+		else if (cls[i].count1 == 1 && cls[i].count2 == 3) {
+			if ((mesh.nodes[cls[i].verts2(0)]->EoL && mesh.nodes[cls[i].verts2(0)]->cornerID == cls[i].verts1(0)) ||
+				(mesh.nodes[cls[i].verts2(1)]->EoL && mesh.nodes[cls[i].verts2(1)]->cornerID == cls[i].verts1(0)) ||
+				(mesh.nodes[cls[i].verts2(2)]->EoL && mesh.nodes[cls[i].verts2(2)]->cornerID == cls[i].verts1(0))) continue;
 				
 			// We don't add new points throughout this loop so this is safe
-			Vert *v0 = mesh.verts[cls[i]->verts2(0)],
-				*v1 = mesh.verts[cls[i]->verts2(1)],
-				*v2 = mesh.verts[cls[i]->verts2(2)];
-			//Face *f0 = mesh.faces[cls[i]->tri2];
+			Vert *v0 = mesh.verts[cls[i].verts2(0)],
+				*v1 = mesh.verts[cls[i].verts2(1)],
+				*v2 = mesh.verts[cls[i].verts2(2)];
+			//Face *f0 = mesh.faces[cls[i].tri2];
 				
 			// TODO:: This may be overkill if the CD weights match the mesh barycoords
-			double xX = cls[i]->weights2(0) * v0->u[0] +
-				cls[i]->weights2(1) * v1->u[0] +
-				cls[i]->weights2(2) * v2->u[0];
-			double yX = cls[i]->weights2(0) * v0->u[1] +
-				cls[i]->weights2(1) * v1->u[1] +
-				cls[i]->weights2(2) * v2->u[1];
+			double xX = cls[i].weights2(0) * v0->u[0] +
+				cls[i].weights2(1) * v1->u[0] +
+				cls[i].weights2(2) * v2->u[0];
+			double yX = cls[i].weights2(0) * v0->u[1] +
+				cls[i].weights2(1) * v1->u[1] +
+				cls[i].weights2(2) * v2->u[1];
 
 			// Boundary
 			if (inBoundaryQ(boundaries, Vector3d(xX, yX, 0.0), boundary)) continue;
 				
 			// Faces CAN be added and deleted throughout this loop so we can't just use the CD returned tri
-			Face *f0 = get_enclosing_face(mesh, Vec2(xX, yX));
+			Face *f0 = get_enclosing_face(mesh, Vec2(xX, yX), v0->adjf[0]);
 			Vec3 bary = get_barycentric_coords(Vec2(xX, yX), f0);
 
 			bool use_edge = false;
@@ -213,36 +217,36 @@ void addGeometry(Mesh& mesh, const MatrixXd &boundaries, const vector<shared_ptr
 			}
 
 			Node *n = mesh.nodes.back();
-			n->EoL = true;
+			set_EoL(n, true);
 			n->EoL_state = Node::NewEOL;
 			n->preserve = true;
-			n->cornerID = cls[i]->verts1(0);
-			n->cdEdges = cls[i]->edge1;
-			n->x = e2v(cls[i]->pos1_); // We want to offset the node slightly inside the obect so it gets detected by the CD until it moves out on it's own
+			n->cornerID = cls[i].verts1(0);
+			n->cdEdges.assign(cls[i].edge1, cls[i].edge1 + cls[i].nedge1);
+			n->x = e2v(cls[i].pos1_); // We want to offset the node slightly inside the obect so it gets detected by the CD until it moves out on it's own
 		}
-		if (cls[i]->count1 == 2 && cls[i]->count2 == 2) {
+		if (cls[i].count1 == 2 && cls[i].count2 == 2) {
 			// TODO:: Is this enough of a check?
-			if (mesh.nodes[cls[i]->verts2(0)]->EoL ||
-				mesh.nodes[cls[i]->verts2(1)]->EoL) continue;
+			if (mesh.nodes[cls[i].verts2(0)]->EoL ||
+				mesh.nodes[cls[i].verts2(1)]->EoL) continue;
 
 			// The verts won't change since we only ever add verts
-			Edge *e0 = get_edge(mesh.nodes[cls[i]->verts2(0)], mesh.nodes[cls[i]->verts2(1)]);
+			Edge *e0 = get_edge(mesh.nodes[cls[i].verts2(0)], mesh.nodes[cls[i].verts2(1)]);
 			double d;
 
 			// We'll need this info for the boundary
-			Vert *v0 = mesh.verts[cls[i]->verts2(0)],
-				*v1 = mesh.verts[cls[i]->verts2(1)];
+			Vert *v0 = mesh.verts[cls[i].verts2(0)],
+				*v1 = mesh.verts[cls[i].verts2(1)];
 
-			double xX = cls[i]->weights2(0) * v0->u[0] +
-				cls[i]->weights2(1) * v1->u[0];
-			double yX = cls[i]->weights2(0) * v0->u[1] +
-				cls[i]->weights2(1) * v1->u[1];
+			double xX = cls[i].weights2(0) * v0->u[0] +
+				cls[i].weights2(1) * v1->u[0];
+			double yX = cls[i].weights2(0) * v0->u[1] +
+				cls[i].weights2(1) * v1->u[1];
 
-			Face *f0 = get_enclosing_face(mesh, Vec2(xX, yX));
+			Face *f0 = get_enclosing_face(mesh, Vec2(xX, yX), v0->adjf[0]);
 
 			// Boundary simple
 			MatrixXd F = deform_grad(f0);
-			Vector2d e2 = F.transpose() * cls[i]->edgeDir;
+			Vector2d e2 = F.transpose() * cls[i].edgeDir;
 			if (inBoundaryN(boundaries, Vector3d(xX, yX, 0.0), Vec3(e2(0), e2(1), 0.0), boundary)) continue;
 
 			// If a previous collisions has already split this edge this get_edge will return NULL and we have to do a little more work to find it
@@ -272,11 +276,11 @@ void addGeometry(Mesh& mesh, const MatrixXd &boundaries, const vector<shared_ptr
 			else {
 				// ArcSim splits an edge using the weight from n[1]
 				// Double check in case the CD does not index the same way
-				if (e0->n[0]->index == cls[i]->verts2(1)) {
-					d = cls[i]->weights2(0);
+				if (e0->n[0]->index == cls[i].verts2(1)) {
+					d = cls[i].weights2(0);
 				}
 				else {
-					d = cls[i]->weights2(1);
+					d = cls[i].weights2(1);
 				}
 			}
 
@@ -291,10 +295,10 @@ void addGeometry(Mesh& mesh, const MatrixXd &boundaries, const vector<shared_ptr
 			op.done();
 
 			Node *n = mesh.nodes.back();
-			n->EoL = true;
+			set_EoL(n, true);
 			n->EoL_state = Node::NewEOL;
-			n->cdEdges = cls[i]->edge1;
-			n->x = e2v(cls[i]->pos1_); // We want to offset the node slightly inside the obect so it gets detected by the CD until it moves out on it's own
+			n->cdEdges.assign(cls[i].edge1, cls[i].edge1 + cls[i].nedge1);
+			n->x = e2v(cls[i].pos1_); // We want to offset the node slightly inside the obect so it gets detected by the CD until it moves out on it's own
 		}
 	}
 }
@@ -305,7 +309,7 @@ void revertWasEOL(Mesh& mesh, const MatrixXd & bounds)
 	for (int n = 0; n < mesh.nodes.size(); n++) {
 		Node* node = mesh.nodes[n];
 		if (node->EoL_state == Node::WasEOL) {
-			node->EoL = false;
+			set_EoL(node, false);
 			node->preserve = false;
 			node->cornerID = -1;
 			node->cdEdges.clear();
@@ -313,7 +317,7 @@ void revertWasEOL(Mesh& mesh, const MatrixXd & bounds)
 		// Boundary
 		if (inBoundary(bounds, node, boundary)) {
 			node->EoL_state == Node::WasEOL;
-			node->EoL = false;
+			set_EoL(node, false);
 			node->preserve = false;
 			node->cornerID = -1;
 			node->cdEdges.clear();
@@ -321,46 +325,77 @@ void revertWasEOL(Mesh& mesh, const MatrixXd & bounds)
 	}
 }
 
-void markPreserve(Mesh& mesh)
+void markPreserve(Edge *e)
 {
-	for (int i = 0; i < mesh.edges.size(); i++) {
-		Edge *e = mesh.edges[i];
-		e->preserve = false;
-		Node *n0 = e->n[0],
-			*n1 = e->n[1];
-		if (n0->EoL && n1->EoL) {
-			// We never connect corners together
-			// TODO:: Is this correct assumption?
-			if (n0->cornerID >= 0 && n1->cornerID >= 0) continue;
-
-			// We check the corner to edge, and edge to edge cases
-			// A corner will have a list of cdEdges, while an edge is garaunteed to only have one cdEdge
-			bool match = false;
-			if (n0->cornerID >= 0) {
-				for (int j = 0; j < n0->cdEdges.size(); j++) {
-					if (n1->cdEdges[0] == n0->cdEdges[j]) {
-						match = true;
-						break;
-					}
+	preserveEvals++;
+	e->preserve = false;
+	Node *n0 = e->n[0],
+		*n1 = e->n[1];
+	if (n0->EoL && n1->EoL) {
+		// We never connect corners together
+		// TODO:: Is this correct assumption?
+		if (n0->cornerID >= 0 && n1->cornerID >= 0) return;
+
+		// We check the corner to edge, and edge to edge cases
+		// A corner will have a list of cdEdges, while an edge is garaunteed to only have one cdEdge
+		bool match = false;
+		if (n0->cornerID >= 0) {
+			for (int j = 0; j < n0->cdEdges.size(); j++) {
+				if (n1->cdEdges[0] == n0->cdEdges[j]) {
+					match = true;
+					break;
 				}
 			}
-			else if (n1->cornerID >= 0) {
-				for (int j = 0; j < n1->cdEdges.size(); j++) {
-					if (n0->cdEdges[0] == n1->cdEdges[j]) {
-						match = true;
-						break;
-					}
+		}
+		else if (n1->cornerID >= 0) {
+			for (int j = 0; j < n1->cdEdges.size(); j++) {
+				if (n0->cdEdges[0] == n1->cdEdges[j]) {
+					match = true;
+					break;
 				}
 			}
-			else if (n0->cdEdges[0] == n1->cdEdges[0]) {
-				match = true;
-			}
+		}
+		else if (n0->cdEdges[0] == n1->cdEdges[0]) {
+			match = true;
+		}
 
-			// If two EoL nodes share an edge AND they share a cdEdge ID
-			// then the connected edge corresponds to object geometry and is preserved
-			if (match) e->preserve = true;
+		// If two EoL nodes share an edge AND they share a cdEdge ID
+		// then the connected edge corresponds to object geometry and is preserved
+		if (match) e->preserve = true;
+	}
+}
+
+// Every preserved edge has an end in EoL_adjacency, so the edges around it are the only ones that can change
+void markPreserve(Mesh& mesh)
+{
+	set<Node*> &nodes = mesh.EoL_adjacency;
+	for (set<Node*>::iterator it = nodes.begin(); it != nodes.end(); ++it) {
+		Node *n = *it;
+		for (int e = 0; e < n->adje.size(); e++) {
+			// An edge between two of the nodes is done from the first one
+			Node *n1 = other_node(n->adje[e], n);
+			if (n1 < n && nodes.count(n1)) continue;
+			markPreserve(n->adje[e]);
 		}
 	}
+	// Only edges between EoL nodes are preserved now
+	for (set<Node*>::iterator it = nodes.begin(); it != nodes.end();) {
+		if ((*it)->EoL) ++it;
+		else it = nodes.erase(it);
+	}
+}
+
+// Only the new edges of an op can have a stale preserve flag, the nodes it kept are unchanged
+void markPreserve(const RemeshOp &op)
+{
+	for (int e = 0; e < op.added_edges.size(); e++) {
+		markPreserve(op.added_edges[e]);
+	}
+}
+
+int preserveEvaluations()
+{
+	return preserveEvals;
 }
 
 double edge_metric(const Vert *vert0, const Vert *vert1);
@@ -405,154 +440,210 @@ bool can_collapseForced(const Edge *edge, int i) {
 // For very illconditioned geometry we can potentially have two preserved edges forming a triangle
 // We want to collapse this triangle and just make the non preserved edge the new single preserved edge
 // This triangle was practically a line it was so thin that nothing is really being altered dramatically
-void pass_collapse(RemeshOp op, Node *n)
+void pass_collapse(const RemeshOp &op, Node *n)
 {
 	for (int e = 0; e < op.removed_edges.size(); e++) {
 		if (op.removed_edges[e]->preserve) {
 			if (op.removed_edges[e]->n[0] == n || op.removed_edges[e]->n[1] == n) continue;
 			Edge *ep = get_edge(n, op.removed_edges[e]->n[0]);
 			if(ep == NULL) ep = get_edge(n, op.removed_edges[e]->n[1]);
-			if (ep != NULL) ep->preserve = true;
+			if (ep != NULL) {
+				ep->preserve = true;
+				n->mesh->EoL_adjacency.insert(n);
+			}
 		}
 	}
 }
 
-bool collapse_conformal(Mesh &mesh, bool &allclear)
+// Candidate edges of a collapse pass, shortest first
+// Ties are broken by the node uuids so the order doesn't depend on allocation addresses
+typedef pair<double, pair<int, int> > EdgeKey;
+typedef map<EdgeKey, Edge*> EdgeWorklist;
+
+EdgeKey edge_key(const Edge *e)
 {
-	for (int i = 0; i < mesh.edges.size(); i++) {
-		Edge *e = mesh.edges[i];
-		if (e->preserve) {
-			if (edge_length(e) < (2.0 * thresh)) {
-				allclear = false;
-				RemeshOp op;
-				Node *n0 = e->n[0],
-					*n1 = e->n[1];
-				if (is_seam_or_boundary(n1) || n1->cornerID >= 0) {
-					if (!can_collapseForced(e, 0)) continue;
-					op = collapse_edgeForced(e, 0);
-					if (op.empty()) continue;
-					pass_collapse(op, n1);
-					op.done();
-					return true;
-				}
-				else if (is_seam_or_boundary(n0) || n0->cornerID >= 0) {
-					if (!can_collapseForced(e, 1)) continue;
-					op = collapse_edgeForced(e, 1);
-					if (op.empty()) continue;
-					pass_collapse(op, n0);
-					op.done();
-					return true;
-				}
-				else {
-					if (n0->verts[0]->adjf.size() <= n1->verts[0]->adjf.size()) {
-						if (!can_collapseForced(e, 1)) op = collapse_edgeForced(e, 1);
-						if (op.empty()) {
-							if (!can_collapseForced(e, 0)) continue;
-							op = collapse_edgeForced(e, 0);
-							if (op.empty()) {
-								continue;
-							}
-							pass_collapse(op, n1);
-						}
-						else pass_collapse(op, n0);
-					}
-					else {
-						if (!can_collapseForced(e, 0)) op = collapse_edgeForced(e, 0);
-						if (op.empty()) {
-							if (!can_collapseForced(e, 1)) continue;
-							op = collapse_edgeForced(e, 1);
-							if (op.empty()) {
-								continue;
-							}
-							pass_collapse(op, n0);
-						}
-						else pass_collapse(op, n1);
-					}
-					op.done();
-					return true;
-				}
-			}
+	int u0 = e->n[0]->uuid,
+		u1 = e->n[1]->uuid;
+	return make_pair(edge_length(e), make_pair(min(u0, u1), max(u0, u1)));
+}
+
+bool conformal_candidate(const Edge *e)
+{
+	return e->preserve && edge_length(e) < (2.0 * thresh);
+}
+
+// Short non preserved edges on a face around an EoL node
+bool nonconformal_candidate(const Edge *e)
+{
+	if (e->preserve || edge_length(e) >= thresh) return false;
+	for (int s = 0; s < 2; s++) {
+		const Face *f = e->adjf[s];
+		if (f == NULL) continue;
+		for (int v = 0; v < 3; v++) {
+			const Node *n = f->v[v]->node;
+			if (n->EoL && n->verts[0] == f->v[v]) return true;
 		}
 	}
 	return false;
 }
 
+void queue_candidate(EdgeWorklist &worklist, Edge *e, bool(*candidate)(const Edge*))
+{
+	if (candidate(e)) worklist[edge_key(e)] = e;
+}
+
+// Lengths don't change while collapsing, so only the edges of the new faces can become candidates
+// Must be called before op.done() so the removed edges can still be looked up
+void update_worklist(EdgeWorklist &worklist, const RemeshOp &op, bool(*candidate)(const Edge*))
+{
+	for (int e = 0; e < op.removed_edges.size(); e++) worklist.erase(edge_key(op.removed_edges[e]));
+	for (int f = 0; f < op.added_faces.size(); f++) {
+		for (int e = 0; e < 3; e++) queue_candidate(worklist, op.added_faces[f]->adje[e], candidate);
+	}
+}
+
+// Collapses a short preserved edge, kept gets the surviving node
+RemeshOp try_collapse_conformal(Edge *e, Node *&kept)
+{
+	RemeshOp op;
+	Node *n0 = e->n[0],
+		*n1 = e->n[1];
+	if (is_seam_or_boundary(n1) || n1->cornerID >= 0) {
+		if (!can_collapseForced(e, 0)) return op;
+		op = collapse_edgeForced(e, 0);
+		kept = n1;
+	}
+	else if (is_seam_or_boundary(n0) || n0->cornerID >= 0) {
+		if (!can_collapseForced(e, 1)) return op;
+		op = collapse_edgeForced(e, 1);
+		kept = n0;
+	}
+	else {
+		if (n0->verts[0]->adjf.size() <= n1->verts[0]->adjf.size()) {
+			if (!can_collapseForced(e, 1)) op = collapse_edgeForced(e, 1);
+			kept = n0;
+			if (op.empty()) {
+				if (!can_collapseForced(e, 0)) return op;
+				op = collapse_edgeForced(e, 0);
+				kept = n1;
+			}
+		}
+		else {
+			if (!can_collapseForced(e, 0)) op = collapse_edgeForced(e, 0);
+			kept = n1;
+			if (op.empty()) {
+				if (!can_collapseForced(e, 1)) return op;
+				op = collapse_edgeForced(e, 1);
+				kept = n0;
+			}
+		}
+	}
+	return op;
+}
+
+// Returns true if any preserved edge was collapsed
+// An edge that can't be collapsed yet is retried after every collapse, the mesh around it may have changed
+bool collapse_conformal(Mesh &mesh, bool &allclear)
+{
+	EdgeWorklist worklist;
+	for (set<Node*>::iterator it = mesh.EoL_adjacency.begin(); it != mesh.EoL_adjacency.end(); ++it) {
+		for (int e = 0; e < (*it)->adje.size(); e++) {
+			queue_candidate(worklist, (*it)->adje[e], conformal_candidate);
+		}
+	}
+	bool collapsed = false;
+	EdgeWorklist::iterator it = worklist.begin();
+	while (it != worklist.end()) {
+		allclear = false;
+		Node *kept = NULL;
+		RemeshOp op = try_collapse_conformal(it->second, kept);
+		if (op.empty()) {
+			++it;
+			continue;
+		}
+		pass_collapse(op, kept);
+		update_worklist(worklist, op, conformal_candidate);
+		for (int e = 0; e < kept->adje.size(); e++) {
+			queue_candidate(worklist, kept->adje[e], conformal_candidate);
+		}
+		op.done();
+		collapsed = true;
+		it = worklist.begin();
+	}
+	return collapsed;
+}
+
+RemeshOp try_collapse_nonconformal(Edge *e0, bool &allclear)
+{
+	RemeshOp op;
+	Node *n0 = e0->n[0],
+		*n1 = e0->n[1];
+	if (n0->EoL && n1->EoL) return op;
+	//if (n0->preserve || n1->preserve) return op; // Don't mess with preserved points which are different from EoL points
+	// Don't deal with edges between boundary and inside
+	if (!(
+		(is_seam_or_boundary(n0) && is_seam_or_boundary(n1)) ||
+		(!is_seam_or_boundary(n0) && !is_seam_or_boundary(n1))
+		)) return op;
+	// These two loops should help fix some rare special cases, but may cause problems??
+	for (int ee = 0; ee < n0->adje.size(); ee++) {
+		if (edge_length(n0->adje[ee]) < edge_length(e0)) return op;
+	}
+	for (int ee = 0; ee < n1->adje.size(); ee++) {
+		if (edge_length(n1->adje[ee]) < edge_length(e0)) return op;
+	}
+	allclear = false;
+	if (n0->EoL) {
+		if (can_collapseForced(e0, 1)) op = collapse_edgeForced(e0, 1);
+	}
+	else if (n1->EoL) {
+		if (can_collapseForced(e0, 0)) op = collapse_edgeForced(e0, 0);
+	}
+	else if (!n0->preserve) {
+		if (can_collapseForced(e0, 0)) op = collapse_edgeForced(e0, 0);
+		if (op.empty() && can_collapseForced(e0, 1)) op = collapse_edgeForced(e0, 1);
+	}
+	else if (!n1->preserve) {
+		if (can_collapseForced(e0, 1)) op = collapse_edgeForced(e0, 1);
+		if (op.empty() && can_collapseForced(e0, 0)) op = collapse_edgeForced(e0, 0);
+	}
+	return op;
+}
+
+// Returns true if any short edge around the EoL nodes was collapsed
 bool collapse_nonconformal(Mesh &mesh, bool &allclear)
 {
-	for (int i = 0; i < mesh.nodes.size(); i++) {
-		Node *n = mesh.nodes[i];
+	EdgeWorklist worklist;
+	for (set<Node*>::iterator it = mesh.EoL_adjacency.begin(); it != mesh.EoL_adjacency.end(); ++it) {
+		Node *n = *it;
 		if (n->EoL) {
 			Vert *v = n->verts[0];
 			for (int f = 0; f < v->adjf.size(); f++) {
 				for (int e = 0; e < 3; e++) {
-					Edge *e0 = v->adjf[f]->adje[e];
-					if (!e0->preserve && edge_length(e0) < thresh) {
-						Node *n0 = e0->n[0],
-							*n1 = e0->n[1];
-						if (n0->EoL && n1->EoL) continue;
-						//if (n0->preserve || n1->preserve) continue; // Don't mess with preserved points which are different from EoL points
-						// Don't deal with edges between boundary and inside
-						if (!(
-							(is_seam_or_boundary(n0) && is_seam_or_boundary(n1)) ||
-							(!is_seam_or_boundary(n0) && !is_seam_or_boundary(n1))
-							)) continue;
-						// These two loops should help fix some rare special cases, but may cause problems??
-						bool worst = true;
-						for (int ee = 0; ee < n0->adje.size(); ee++) {
-							Edge *e1 = n0->adje[ee];
-							if (edge_length(e1) < edge_length(e0)) worst = false;
-						}
-						for (int ee = 0; ee < n1->adje.size(); ee++) {
-							Edge *e1 = n1->adje[ee];
-							if (edge_length(e1) < edge_length(e0)) worst = false;
-						}
-						if (!worst) continue;
-						allclear = false;
-						RemeshOp op;
-						if (n0->EoL) {
-							if (!can_collapseForced(e0, 1)) continue;
-							op = collapse_edgeForced(e0, 1);
-							if (op.empty()) continue;
-							op.done();
-							return true;
-						}
-						else if (n1->EoL) {
-							if (!can_collapseForced(e0, 0)) continue;
-							op = collapse_edgeForced(e0, 0);
-							if (op.empty()) continue;
-							op.done();
-							return true;
-						}
-						else {
-							if (!n0->preserve) {
-								if (can_collapseForced(e0, 0)) op = collapse_edgeForced(e0, 0);
-								if (op.empty()) {
-									if (!can_collapseForced(e0, 1)) continue;
-									op = collapse_edgeForced(e0, 1);
-									if (op.empty()) {
-										continue;
-									}
-								}
-							}
-							else if (!n1->preserve) {
-								if (can_collapseForced(e0, 1)) op = collapse_edgeForced(e0, 1);
-								if (op.empty()) {
-									if (!can_collapseForced(e0, 0)) continue;
-									op = collapse_edgeForced(e0, 0);
-									if (op.empty()) {
-										continue;
-									}
-								}
-							}
-							op.done();
-							return true;
-						}
-					}
+					queue_candidate(worklist, v->adjf[f]->adje[e], nonconformal_candidate);
 				}
 			}
 		}
 	}
-	return false;
+	bool collapsed = false;
+	EdgeWorklist::iterator it = worklist.begin();
+	while (it != worklist.end()) {
+		// A collapse can take the faces of an EoL node away from a queued edge
+		if (!nonconformal_candidate(it->second)) {
+			it = worklist.erase(it);
+			continue;
+		}
+		RemeshOp op = try_collapse_nonconformal(it->second, allclear);
+		if (op.empty()) {
+			++it;
+			continue;
+		}
+		update_worklist(worklist, op, nonconformal_candidate);
+		op.done();
+		collapsed = true;
+		it = worklist.begin();
+	}
+	return collapsed;
 }
 
 //bool collapse_close(Mesh &mesh)
@@ -658,6 +749,7 @@ bool split_illconditioned_faces(Mesh &mesh)
 		}
 		else if(cc == 3) {
 			Edge *e0 = single_nonconformal_edge_from_face(f0);
+			if (e0 == NULL) continue; // If a collapse left a triangle of preserved edges
 			if (face_altitude(e0, f0) < thresh / 2) {
 				bad_edges.push_back(e0);
 				case_pair.push_back(3);
@@ -685,13 +777,14 @@ bool split_illconditioned_faces(Mesh &mesh)
 		// If we've split a conformal edge, this new node is EoL and must have the appropriate data
 		if (case_pair[e] == 2) {
 			Node *node = op.added_nodes[0]; // There should only be one?
-			node->EoL = true;
+			set_EoL(node, true);
 			if (node0->EoL_state == Node::IsEOL && node1->EoL_state == Node::IsEOL) node->EoL_state = Node::NewEOLFromSplit;
 			else node->EoL_state = Node::NewEOL;
 			// Transfer cdEdges from the non corner EoL node
 			// This should be safe?
 			if (node0->cornerID >= 0) node->cdEdges = node1->cdEdges;
 			else node->cdEdges = node0->cdEdges;
+			markPreserve(op);
 		}
 		op.set_null(bad_edges);
 		op.done();
@@ -715,20 +808,21 @@ void cleanup(Mesh& mesh)
 		// If a bad edge exists, but is unsafe to collapse, try in the next iteration where it may become safe, or another operation may take care of it
 		while(!allclear) {
 			allclear = true;
-			while (collapse_nonconformal(mesh, allclear));
-			markPreserve(mesh); // Can be removed if the conformal pass doesn't loop over edges and check for preserve status
-			while (collapse_conformal(mesh, allclear));
+			collapse_nonconformal(mesh, allclear);
+			markPreserve(mesh);
+			collapse_conformal(mesh, allclear);
 		}
 		allclear = split_illconditioned_faces(mesh);
 		//allclear = true;
 	}
-	markPreserve(mesh); // Probably doesn't need to be called so much, but wan't to be safe
+	markPreserve(mesh);
 }
 
 // TODO:: I think there are problems when a box corner reaches the cloth border and the two box edges still move through the cloth
 
-void preprocess(Mesh& mesh, const MatrixXd &boundaries, const vector<shared_ptr<btc::Collision> > cls)
+void preprocess(Mesh& mesh, const MatrixXd &boundaries, const vector<btc::Collision> &cls)
 {
+	preserveEvals = 0;
 	markWasEOL(mesh);
 	addGeometry(mesh, boundaries, cls);
 	//revertWasEOL(mesh, boundaries);
@@ -744,12 +838,13 @@ void preprocess(Mesh& mesh, const MatrixXd &boundaries, const vector<shared_ptr<
 
 void preprocessClean(Mesh& mesh)
 {
+	preserveEvals = 0;
 	cleanup(mesh);
 	compute_ws_data(mesh);
 }
 
 bool a;
-void preprocessPart(Mesh& mesh, const MatrixXd &boundaries, const vector<shared_ptr<btc::Collision> > cls, int &part)
+void preprocessPart(Mesh& mesh, const MatrixXd &boundaries, const vector<btc::Collision> &cls, int &part)
 {
 	if (part == 1) {
 		//for (int i = 0; i < mesh.nodes.size(); i++) {
@@ -761,6 +856,7 @@ void preprocessPart(Mesh& mesh, const MatrixXd &boundaries, const vector<shared_
 		//	mesh.edges[i]->preserve = false;
 		//}
 		a = true;
+		preserveEvals = 0;
 		markWasEOL(mesh);
 		addGeometry(mesh, boundaries, cls);
 		revertWasEOL(mesh, boundaries);
@@ -779,12 +875,12 @@ void preprocessPart(Mesh& mesh, const MatrixXd &boundaries, const vector<shared_
 	}
 	else if (part == 4) {
 		a = true;
-		while (collapse_nonconformal(mesh,a));
+		collapse_nonconformal(mesh, a);
 		markPreserve(mesh);
 		cout << "Collapse nonfornformal" << endl;
 	}
 	else if (part == 5) {
-		while (collapse_conformal(mesh,a));
+		collapse_conformal(mesh, a);
 		if (!a) part = 3;
 		cout << "Collapse conformal" << endl;
 	}
@@ -5,10 +5,13 @@
 #include "external/ArcSim/mesh.hpp"
 #include "boxTriCollision.h"
 
-void preprocess(Mesh& mesh, const Eigen::MatrixXd &boundaries, std::vector<std::shared_ptr<btc::Collision> > cls);
+void preprocess(Mesh& mesh, const Eigen::MatrixXd &boundaries, const std::vector<btc::Collision> &cls);
 
-void preprocessPart(Mesh& mesh, const Eigen::MatrixXd &boundaries, const std::vector<std::shared_ptr<btc::Collision> > cls, int &part);
+void preprocessPart(Mesh& mesh, const Eigen::MatrixXd &boundaries, const std::vector<btc::Collision> &cls, int &part);
 
 void preprocessClean(Mesh& mesh);
 
+// Edges whose preserve flag was re-evaluated by the last preprocess, preprocessClean or partial preprocess
+int preserveEvaluations();
+
 #endif
\ No newline at end of file
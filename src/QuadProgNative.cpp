@@ -0,0 +1,270 @@
+#include "QuadProgNative.h"
+
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <cmath>
+
+using namespace std;
+using namespace Eigen;
+
+typedef Triplet<double> T;
+
+QuadProgNative::QuadProgNative() :
+	maxIters(4000),
+	checkEvery(25),
+	epsAbs(1e-7),
+	epsRel(1e-7),
+	sigma(1e-8),
+	rho(0.1),
+	rhoEqScale(1e3),
+	alpha(1.6),
+	verbose(false),
+	warmStart(true),
+	linearSolver(QuadProgNative::Direct),
+	cgTolerance(1e-10),
+	iterations(0),
+	refactorizations(0),
+	cgIterations(0),
+	reusedAnalysis(false),
+	primalResidual(0.0),
+	dualResidual(0.0),
+	analyzed(false),
+	meqLast(-1)
+{
+
+}
+
+void QuadProgNative::buildKKT(const BlockSystem& P, const SparseMatrix<double>& A, const VectorXd& rhoVec)
+{
+	int n = P.rows();
+	int m = A.rows();
+
+	// Only the lower triangle is stored, every diagonal entry is always present
+	// so that rho updates can be written straight into the values
+	vector<T> kkt_;
+	kkt_.reserve(P.nonZeros() / 2 + n + A.nonZeros() + m);
+	P.triplets(kkt_, true);
+	for (int i = 0; i < n; i++) kkt_.push_back(T(i, i, sigma));
+	for (int k = 0; k < A.outerSize(); k++) {
+		for (SparseMatrix<double>::InnerIterator it(A, k); it; ++it) {
+			kkt_.push_back(T(n + it.row(), it.col(), it.value()));
+		}
+	}
+	for (int i = 0; i < m; i++) kkt_.push_back(T(n + i, n + i, -1.0 / rhoVec(i)));
+
+	KKT.resize(n + m, n + m);
+	KKT.setFromTriplets(kkt_.begin(), kkt_.end());
+	KKT.makeCompressed();
+}
+
+void QuadProgNative::updateRho(const VectorXd& rhoVec)
+{
+	// Column major lower triangle, so the diagonal is the first entry of each column
+	int n = KKT.rows() - rhoVec.size();
+	for (int i = 0; i < rhoVec.size(); i++) {
+		KKT.valuePtr()[KKT.outerIndexPtr()[n + i]] = -1.0 / rhoVec(i);
+	}
+}
+
+void QuadProgNative::buildReduced(const BlockSystem& P, const SparseMatrix<double>& A, const VectorXd& rhoVec)
+{
+	// Never assembled, CG multiplies through the blocks of P and through A
+	reduced = P;
+	reduced.setPenalty(sigma, A, rhoVec);
+	cg.setTolerance(cgTolerance);
+	cg.preconditioner().setBlocks(blocks);
+	cg.compute(reduced);
+	refactorizations++;
+}
+
+bool QuadProgNative::samePattern() const
+{
+	if (!analyzed) return false;
+	if (patternOuter.size() != KKT.outerSize() + 1) return false;
+	if (patternInner.size() != KKT.nonZeros()) return false;
+	for (int i = 0; i < patternOuter.size(); i++) {
+		if (patternOuter(i) != KKT.outerIndexPtr()[i]) return false;
+	}
+	for (int i = 0; i < patternInner.size(); i++) {
+		if (patternInner(i) != KKT.innerIndexPtr()[i]) return false;
+	}
+	return true;
+}
+
+bool QuadProgNative::sameEqualities(const SparseMatrix<double>& Aeq) const
+{
+	if (meqLast != Aeq.rows() || (int)eqRowsLast.size() != Aeq.nonZeros()) return false;
+	int i = 0;
+	for (int k = 0; k < Aeq.outerSize(); k++) {
+		for (SparseMatrix<double>::InnerIterator it(Aeq, k); it; ++it, i++) {
+			if (it.row() != eqRowsLast[i] || it.col() != eqColsLast[i]) return false;
+		}
+	}
+	return true;
+}
+
+bool QuadProgNative::factor()
+{
+	if (!samePattern()) {
+		ldlt.analyzePattern(KKT);
+		patternOuter = Map<const VectorXi>(KKT.outerIndexPtr(), KKT.outerSize() + 1);
+		patternInner = Map<const VectorXi>(KKT.innerIndexPtr(), KKT.nonZeros());
+		analyzed = true;
+	}
+	else if (refactorizations == 0) {
+		reusedAnalysis = true;
+	}
+	ldlt.factorize(KKT);
+	refactorizations++;
+	return ldlt.info() == Success;
+}
+
+bool QuadProgNative::solve(const BlockSystem& P, const VectorXd& q,
+	const SparseMatrix<double>& Aeq, const VectorXd& beq,
+	const SparseMatrix<double>& Aineq, const VectorXd& bineq,
+	VectorXd& x)
+{
+	double inf = numeric_limits<double>::infinity();
+	int n = q.size();
+	int meq = beq.size();
+	int m = meq + bineq.size();
+
+	iterations = 0;
+	refactorizations = 0;
+	cgIterations = 0;
+	reusedAnalysis = false;
+
+	// Stack the equalities and inequalities as l <= A*x <= u
+	SparseMatrix<double> A(m, n);
+	VectorXd l(m), u(m);
+	if (m > 0) {
+		vector<T> a_;
+		a_.reserve(Aeq.nonZeros() + Aineq.nonZeros());
+		for (int k = 0; k < Aeq.outerSize() && meq > 0; k++) {
+			for (SparseMatrix<double>::InnerIterator it(Aeq, k); it; ++it) {
+				a_.push_back(T(it.row(), it.col(), it.value()));
+			}
+		}
+		for (int k = 0; k < Aineq.outerSize() && m > meq; k++) {
+			for (SparseMatrix<double>::InnerIterator it(Aineq, k); it; ++it) {
+				a_.push_back(T(meq + it.row(), it.col(), it.value()));
+			}
+		}
+		A.setFromTriplets(a_.begin(), a_.end());
+		l << beq, VectorXd::Constant(m - meq, -inf);
+		u << beq, bineq;
+	}
+
+	VectorXd rhoVec(m);
+	for (int i = 0; i < m; i++) rhoVec(i) = i < meq ? rho * rhoEqScale : rho;
+
+	bool direct = linearSolver == QuadProgNative::Direct;
+	if (direct) {
+		buildKKT(P, A, rhoVec);
+		if (!factor()) {
+			cout << "Native QP: KKT factorization failed" << endl;
+			return false;
+		}
+	}
+	else {
+		buildReduced(P, A, rhoVec);
+	}
+
+	if (x.size() != n) x.setZero(n);
+	VectorXd z = (A * x).cwiseMax(l).cwiseMin(u);
+	VectorXd y = VectorXd::Zero(m);
+	// Collision rows are regenerated every step with no correspondence to the last ones, so only the
+	// equality duals are reused, and only when the rows constrain the same variables as last time
+	bool sameEq = sameEqualities(Aeq);
+	if (warmStart && sameEq && yLast.size() == meq) y.head(meq) = yLast;
+	VectorXd rhs(n + m), sol(n + m);
+	VectorXd xt = x, zt(m), zr(m);
+	VectorXd Ax(m), Px(n), Aty(n);
+
+	bool converged = false;
+	for (iterations = 1; iterations <= maxIters; iterations++) {
+		if (direct) {
+			rhs.head(n) = sigma * x - q;
+			rhs.tail(m) = z - y.cwiseQuotient(rhoVec);
+			sol = ldlt.solve(rhs);
+			xt = sol.head(n);
+			zt = z + (sol.tail(m) - y).cwiseQuotient(rhoVec);
+		}
+		else {
+			// Same step with the constraint rows eliminated, the last xt is a good guess
+			xt = cg.solveWithGuess(sigma * x - q + A.transpose() * (rhoVec.cwiseProduct(z) - y), xt);
+			cgIterations += cg.iterations();
+			zt = A * xt;
+		}
+
+		x = alpha * xt + (1.0 - alpha) * x;
+		zr = alpha * zt + (1.0 - alpha) * z;
+		z = (zr + y.cwiseQuotient(rhoVec)).cwiseMax(l).cwiseMin(u);
+		y += rhoVec.cwiseProduct(zr - z);
+
+		if (m > 0 && iterations % checkEvery != 0 && iterations != maxIters) continue;
+
+		Ax = A * x;
+		P.multiply(x, Px);
+		Aty = A.transpose() * y;
+		primalResidual = m > 0 ? (Ax - z).lpNorm<Infinity>() : 0.0;
+		dualResidual = (Px + q + Aty).lpNorm<Infinity>();
+
+		double normAx = m > 0 ? Ax.lpNorm<Infinity>() : 0.0;
+		double normz = m > 0 ? z.lpNorm<Infinity>() : 0.0;
+		double epsPrim = epsAbs + epsRel * max(normAx, normz);
+		double epsDual = epsAbs + epsRel * max(max(Px.lpNorm<Infinity>(), Aty.lpNorm<Infinity>()), q.lpNorm<Infinity>());
+		if (primalResidual <= epsPrim && dualResidual <= epsDual) {
+			converged = true;
+			break;
+		}
+
+		// Rebalance rho, only the numeric factorization is redone
+		if (m > 0) {
+			double scale = sqrt((primalResidual / max(max(normAx, normz), 1e-12)) /
+				max(dualResidual / max(max(Px.lpNorm<Infinity>(), Aty.lpNorm<Infinity>()), max(q.lpNorm<Infinity>(), 1e-12)), 1e-12));
+			double rhoNew = min(max(rho * scale, 1e-6), 1e6);
+			if (rhoNew > 5.0 * rho || rhoNew < 0.2 * rho) {
+				rho = rhoNew;
+				for (int i = 0; i < m; i++) rhoVec(i) = i < meq ? rho * rhoEqScale : rho;
+				if (direct) {
+					updateRho(rhoVec);
+					if (!factor()) {
+						cout << "Native QP: KKT refactorization failed" << endl;
+						return false;
+					}
+				}
+				else {
+					buildReduced(P, A, rhoVec);
+				}
+			}
+		}
+	}
+	if (iterations > maxIters) iterations = maxIters;
+
+	yLast = y.head(meq);
+	if (!sameEq) {
+		eqRowsLast.resize(Aeq.nonZeros());
+		eqColsLast.resize(Aeq.nonZeros());
+		int i = 0;
+		for (int k = 0; k < Aeq.outerSize(); k++) {
+			for (SparseMatrix<double>::InnerIterator it(Aeq, k); it; ++it, i++) {
+				eqRowsLast[i] = it.row();
+				eqColsLast[i] = it.col();
+			}
+		}
+		meqLast = meq;
+	}
+
+	if (verbose) {
+		cout << "Native QP: " << (converged ? "converged" : "hit iteration limit") <<
+			" in " << iterations << " iterations, " <<
+			refactorizations << (direct ? " factorizations" : " preconditioner setups") << (reusedAnalysis ? " (reused analysis)" : "") <<
+			(direct ? "" : ", " + to_string(cgIterations) + " CG iterations") <<
+			", primal residual " << primalResidual <<
+			", dual residual " << dualResidual << endl;
+	}
+
+	return converged;
+}
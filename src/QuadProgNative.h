@@ -0,0 +1,83 @@
+#pragma once
+#ifndef __QuadProgNative__
+#define __QuadProgNative__
+
+#define EIGEN_DONT_ALIGN_STATICALLY
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include <vector>
+
+#include "BlockPreconditioner.h"
+#include "BlockSystem.h"
+
+// Sparse convex QP solver built only on Eigen, used when no external solver is available
+// Solves min 0.5*x'*P*x + q'*x  s.t.  Aeq*x = beq,  Aineq*x <= bineq
+// with an OSQP style ADMM on the quasi-definite KKT matrix
+//    [ P + sigma*I     A'    ]
+//    [      A      -1/rho*I  ]
+// The symbolic LDLT analysis is kept between solves and only redone when the KKT pattern changes
+// Alternatively the x update can use block-Jacobi preconditioned CG on the reduced system
+//    (P + sigma*I + A'*diag(rho)*A) x = sigma*x - q + A'*(rho.*z - y)
+class QuadProgNative
+{
+public:
+	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+	QuadProgNative();
+	virtual ~QuadProgNative() {}
+
+	int maxIters;
+	int checkEvery; // Convergence and rho adaptation interval
+	double epsAbs;
+	double epsRel;
+	double sigma;
+	double rho;
+	double rhoEqScale; // Equality rows use a stiffer penalty
+	double alpha; // Over relaxation
+	bool verbose;
+	bool warmStart; // Start the equality duals from the last solve, x always starts from the value passed in
+
+	enum LinearSolver {
+		Direct = 0, BlockCG = 1
+	};
+	int linearSolver;
+	double cgTolerance;
+	std::vector<int> blocks; // Node blocks for the CG preconditioner, see BlockJacobiPreconditioner
+
+	// Statistics from the last call to solve
+	int iterations;
+	int refactorizations;
+	int cgIterations; // Total inner CG iterations with the BlockCG linear solver
+	bool reusedAnalysis;
+	double primalResidual;
+	double dualResidual;
+
+	// P is only multiplied, and read entry by entry for the LDLT
+	bool solve(const BlockSystem& P, const Eigen::VectorXd& q,
+		const Eigen::SparseMatrix<double>& Aeq, const Eigen::VectorXd& beq,
+		const Eigen::SparseMatrix<double>& Aineq, const Eigen::VectorXd& bineq,
+		Eigen::VectorXd& x);
+
+private:
+	Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>, Eigen::Lower> ldlt;
+	Eigen::SparseMatrix<double> KKT;
+	Eigen::VectorXi patternOuter;
+	Eigen::VectorXi patternInner;
+	bool analyzed;
+	BlockSystem reduced;
+	Eigen::ConjugateGradient<BlockSystem, Eigen::Lower | Eigen::Upper, BlockJacobiPreconditioner> cg;
+	Eigen::VectorXd yLast; // Equality duals of the last solve
+	int meqLast;
+	std::vector<int> eqRowsLast; // Pattern of the last Aeq, the duals are only reused for the same rows
+	std::vector<int> eqColsLast;
+
+	void buildKKT(const BlockSystem& P, const Eigen::SparseMatrix<double>& A, const Eigen::VectorXd& rhoVec);
+	void updateRho(const Eigen::VectorXd& rhoVec);
+	bool samePattern() const;
+	bool sameEqualities(const Eigen::SparseMatrix<double>& Aeq) const;
+	bool factor();
+	void buildReduced(const BlockSystem& P, const Eigen::SparseMatrix<double>& A, const Eigen::VectorXd& rhoVec);
+};
+
+#endif
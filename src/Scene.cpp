@@ -5,11 +5,14 @@
 #include "Preprocessor.h"
 #include "Collisions.h"
 #include "Constraints.h"
+#include "Forces.h"
 #include "GeneralizedSolver.h"
 #include "matlabOutputs.h"
 
 #include "external/ArcSim/dynamicremesh.hpp"
 
+#include <chrono>
+
 #ifdef EOLC_ONLINE
 #include "online/MatrixStack.h"
 #include "online/Program.h"
@@ -78,17 +81,32 @@ void Scene::step(const bool& online, const bool& exportObjs)
 		return;
 	}
 	cloth->updateFix(t);
+	unsigned long long topology = cloth->mesh.topology_stamp;
 	if (EOLon) {
 		cloth->updatePreviousMesh();
 		CD(cloth->mesh, obs, cls);
+		auto start = chrono::steady_clock::now();
 		preprocess(cloth->mesh, cloth->boundaries, cls);
+		if (GS->logTiming) {
+			cout << "Preprocess: " << preserveEvaluations() << " preserve evaluations in " <<
+				chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() << " ms" << endl;
+		}
 		//cout << "pre" << endl;
 	}
 	if (REMESHon) {
 		dynamic_remesh(cloth->mesh);
 		set_indices(cloth->mesh);
 	}
+	// The M and MDK pattern and the collision mesh are only rebuilt when preprocessing or remeshing actually changed the mesh
+	if (cloth->mesh.topology_stamp != topology) {
+		cloth->myForces->invalidatePattern();
+		obs->cmesh->invalidate();
+	}
+	else if (EOLon || REMESHon) {
+		obs->cmesh->invalidatePositions();
+	}
 	cloth->step(GS, obs, grav, h, REMESHon, online);
+	obs->cmesh->invalidatePositions();
 	obs->step(h);
 	cls.clear();
 	//mesh2m(cloth->mesh, "mesh.m", true);
@@ -106,18 +124,35 @@ void Scene::partialStep()
 		cout << "CD" << endl;
 	}
 	else if (part >= 1 && part < 8) {
+		unsigned long long topology = cloth->mesh.topology_stamp;
 		preprocessPart(cloth->mesh, cloth->boundaries, cls, part);
 		set_indices(cloth->mesh);
+		if (cloth->mesh.topology_stamp != topology) {
+			cloth->myForces->invalidatePattern();
+			obs->cmesh->invalidate();
+		}
+		else {
+			obs->cmesh->invalidatePositions();
+		}
 		cloth->updateBuffers();
 		mesh2m(cloth->mesh, "mesh.m", true);
 	}
 	else if (part == 8) {
+		unsigned long long topology = cloth->mesh.topology_stamp;
 		dynamic_remesh(cloth->mesh);
 		set_indices(cloth->mesh);
+		if (cloth->mesh.topology_stamp != topology) {
+			cloth->myForces->invalidatePattern();
+			obs->cmesh->invalidate();
+		}
+		else {
+			obs->cmesh->invalidatePositions();
+		}
 		cloth->updateBuffers();
 	}
 	else if (part == 9) {
 		cloth->step(GS, obs, grav, h, REMESHon, true);
+		obs->cmesh->invalidatePositions();
 		obs->step(h);
 		cout << "Finished step" << endl;
 		cls.clear();
@@ -55,7 +55,7 @@ public:
 
 	std::shared_ptr<Cloth> cloth;
 	std::shared_ptr<Obstacles> obs;
-	std::vector<std::shared_ptr<btc::Collision> > cls;
+	std::vector<btc::Collision> cls; // Cleared every step, its storage is reused
 	
 private:
 
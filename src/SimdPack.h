@@ -0,0 +1,103 @@
+#pragma once
+#ifndef __SimdPack__
+#define __SimdPack__
+
+#include <cmath>
+
+#if defined(__AVX512F__) || defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+// N doubles that go through the same arithmetic together, one lane per element
+// Only what the generated element kernels use is defined: + - * /, negation, sqrt and integer pow
+// The generic version is plain loops the compiler is free to vectorize, AVX and AVX-512 have their own specializations
+template <int N>
+struct SimdPack
+{
+	enum { Width = N };
+
+	double v[N];
+
+	SimdPack() {}
+	SimdPack(double a) { for (int i = 0; i < N; i++) v[i] = a; }
+
+	double& operator[](int i) { return v[i]; }
+	double operator[](int i) const { return v[i]; }
+
+	friend SimdPack operator+(const SimdPack& a, const SimdPack& b) { SimdPack r; for (int i = 0; i < N; i++) r.v[i] = a.v[i] + b.v[i]; return r; }
+	friend SimdPack operator-(const SimdPack& a, const SimdPack& b) { SimdPack r; for (int i = 0; i < N; i++) r.v[i] = a.v[i] - b.v[i]; return r; }
+	friend SimdPack operator*(const SimdPack& a, const SimdPack& b) { SimdPack r; for (int i = 0; i < N; i++) r.v[i] = a.v[i] * b.v[i]; return r; }
+	friend SimdPack operator/(const SimdPack& a, const SimdPack& b) { SimdPack r; for (int i = 0; i < N; i++) r.v[i] = a.v[i] / b.v[i]; return r; }
+	friend SimdPack operator-(const SimdPack& a) { SimdPack r; for (int i = 0; i < N; i++) r.v[i] = -a.v[i]; return r; }
+	friend SimdPack sqrt(const SimdPack& a) { SimdPack r; for (int i = 0; i < N; i++) r.v[i] = std::sqrt(a.v[i]); return r; }
+};
+
+#ifdef __AVX__
+template <>
+struct SimdPack<4>
+{
+	enum { Width = 4 };
+
+	__m256d v;
+
+	SimdPack() {}
+	SimdPack(double a) : v(_mm256_set1_pd(a)) {}
+	SimdPack(__m256d a) : v(a) {}
+
+	double& operator[](int i) { return reinterpret_cast<double*>(&v)[i]; }
+	double operator[](int i) const { return reinterpret_cast<const double*>(&v)[i]; }
+
+	friend SimdPack operator+(const SimdPack& a, const SimdPack& b) { return _mm256_add_pd(a.v, b.v); }
+	friend SimdPack operator-(const SimdPack& a, const SimdPack& b) { return _mm256_sub_pd(a.v, b.v); }
+	friend SimdPack operator*(const SimdPack& a, const SimdPack& b) { return _mm256_mul_pd(a.v, b.v); }
+	friend SimdPack operator/(const SimdPack& a, const SimdPack& b) { return _mm256_div_pd(a.v, b.v); }
+	friend SimdPack operator-(const SimdPack& a) { return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0)); }
+	friend SimdPack sqrt(const SimdPack& a) { return _mm256_sqrt_pd(a.v); }
+};
+#endif // __AVX__
+
+#ifdef __AVX512F__
+template <>
+struct SimdPack<8>
+{
+	enum { Width = 8 };
+
+	__m512d v;
+
+	SimdPack() {}
+	SimdPack(double a) : v(_mm512_set1_pd(a)) {}
+	SimdPack(__m512d a) : v(a) {}
+
+	double& operator[](int i) { return reinterpret_cast<double*>(&v)[i]; }
+	double operator[](int i) const { return reinterpret_cast<const double*>(&v)[i]; }
+
+	friend SimdPack operator+(const SimdPack& a, const SimdPack& b) { return _mm512_add_pd(a.v, b.v); }
+	friend SimdPack operator-(const SimdPack& a, const SimdPack& b) { return _mm512_sub_pd(a.v, b.v); }
+	friend SimdPack operator*(const SimdPack& a, const SimdPack& b) { return _mm512_mul_pd(a.v, b.v); }
+	friend SimdPack operator/(const SimdPack& a, const SimdPack& b) { return _mm512_div_pd(a.v, b.v); }
+	friend SimdPack operator-(const SimdPack& a) { return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a.v), _mm512_set1_epi64(0x8000000000000000LL))); }
+	friend SimdPack sqrt(const SimdPack& a) { return _mm512_sqrt_pd(a.v); }
+};
+#endif // __AVX512F__
+
+// Integer powers by repeated squaring, pow(x, 2) is exactly x * x as in the scalar kernels
+template <int N>
+inline SimdPack<N> pow(const SimdPack<N>& a, int p)
+{
+	if (p == 2) return a * a;
+	SimdPack<N> r(1.0), b = a;
+	for (int e = p < 0 ? -p : p; e > 0; e >>= 1) {
+		if (e & 1) r = r * b;
+		b = b * b;
+	}
+	return p < 0 ? SimdPack<N>(1.0) / r : r;
+}
+
+// Widest pack the build's instruction set supports
+#if defined(__AVX512F__)
+typedef SimdPack<8> ElementPack;
+#else
+typedef SimdPack<4> ElementPack;
+#endif
+
+#endif
@@ -10,9 +10,9 @@
 using namespace std;
 using namespace Eigen;
 
-MatrixXd deform_grad(const Face *f)
+Matrix3x2d deform_grad(const Face *f)
 {
-	MatrixXd Dx(3, 2);
+	Matrix3x2d Dx;
 	Dx(0, 0) = f->v[1]->node->x[0] - f->v[0]->node->x[0];
 	Dx(0, 1) = f->v[2]->node->x[0] - f->v[0]->node->x[0];
 	Dx(1, 0) = f->v[1]->node->x[1] - f->v[0]->node->x[1];
@@ -27,7 +27,7 @@ MatrixXd deform_grad(const Face *f)
 	return Dx * DX.inverse();
 }
 
-MatrixXd deform_grad_v(const Vert* v)
+Matrix3x2d deform_grad_v(const Vert* v)
 {
 	double tot_ang = 0.0;
 	Matrix3d Q = Matrix3d::Zero();
@@ -36,13 +36,13 @@ MatrixXd deform_grad_v(const Vert* v)
 	for (int f = 0; f < v->adjf.size(); f++) {
 		Face* face = v->adjf[f];
 
-		MatrixXd F = deform_grad(face);
-		JacobiSVD<MatrixXd> svd(F, ComputeFullU | ComputeFullV);
+		Matrix3x2d F = deform_grad(face);
+		JacobiSVD<Matrix3x2d> svd(F, ComputeFullU | ComputeFullV);
 
-		MatrixXd V3(2, 3);
+		Matrix<double, 2, 3> V3;
 		V3 << svd.matrixV(), Vector2d::Zero();
 
-		MatrixXd Qx = svd.matrixU() * V3.transpose();
+		Matrix3x2d Qx = svd.matrixU() * V3.transpose();
 		Matrix3d Qxrot;
 		Qxrot << Qx.col(0), Qx.col(1), Qx.block<3,1>(0,0).cross(Qx.block<3,1>(0,1));
 
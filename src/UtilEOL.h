@@ -7,8 +7,10 @@
 #define EIGEN_DONT_ALIGN_STATICALLY
 #include <Eigen/Dense>
 
-Eigen::MatrixXd deform_grad(const Face *f);
+typedef Eigen::Matrix<double, 3, 2> Matrix3x2d;
 
-Eigen::MatrixXd deform_grad_v(const Vert* v);
+Matrix3x2d deform_grad(const Face *f);
+
+Matrix3x2d deform_grad_v(const Vert* v);
 
 #endif
\ No newline at end of file
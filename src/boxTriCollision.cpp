@@ -3,6 +3,7 @@
 #include <string.h>
 #include <iostream>
 #include <random>
+#include <algorithm>
 
 #include "boxTriCollision.h"
 
@@ -115,15 +116,14 @@ namespace btc
 		weights2 = Vector3d::Zero();
 		tri1 = -1;
 		tri2 = -1;
+		edge1[0] = -1;
+		edge1[1] = -1;
+		edge1[2] = -1;
+		nedge1 = 0;
 		edge2 = -1;
 		edgeDir = Vector3d::Zero();
 	}
 
-	Collision::~Collision()
-	{
-
-	}
-
 	/**
 	* Output: an array of structures corresponds to an edge. The vertex ordering
 	* is as follows:
@@ -282,6 +282,31 @@ namespace btc
 		return normals;
 	}
 
+	MatrixXd createJitter(int nverts, unsigned int seed)
+	{
+		// The same sequence as the per call generator this replaces, so seed 1 gives the same contacts
+		std::mt19937 gen;
+		std::uniform_real_distribution<> dis(-1.0, 1.0);
+		gen.seed(seed);
+		MatrixXd jitter(3, nverts);
+		for (int i2 = 0; i2 < nverts; ++i2) {
+			jitter(0, i2) = dis(gen);
+			jitter(1, i2) = dis(gen);
+			jitter(2, i2) = dis(gen);
+		}
+		return jitter;
+	}
+
+	void perturbVerts(MatrixXd &pverts, const MatrixXd &verts, const MatrixXd &jitter, double threshold)
+	{
+		pverts.resize(3, verts.cols());
+		for (int i2 = 0; i2 < verts.cols(); ++i2) {
+			for (int i = 0; i < 3; ++i) {
+				pverts(i, i2) = verts(i, i2) + jitter(i, i2)*threshold*1e-3;
+			}
+		}
+	}
+
 	///////////////////////////////////////////////////////////////////////////////
 	// Box geometry data
 	///////////////////////////////////////////////////////////////////////////////
@@ -391,13 +416,15 @@ namespace btc
 	Map<Matrix<double, 3, 8, ColMajor> > vertEdgeWeights1(vertEdgeWeights1_data);
 	Map<Matrix<int, 2, 12, ColMajor> > edgeFaces1(edgeFaces1_data);
 	Map<Matrix<double, 4, 14, ColMajor> > verts1_(verts1_data);
-	Matrix<double, 4, 14> verts1;
-	Matrix<double, 3, 12> edgeNors1c;
-	Matrix<double, 3, 12> edgeNors1d;
-	MatrixXd faceNors1;
-	MatrixXd vertNors1;
 
-	void createBox(vector<shared_ptr<Edge> > &edges1, const Vector3d &whd1, const Matrix4d &E1)
+	// The posed box geometry is returned rather than kept globally, so boxes can be checked from several threads
+	void createBox(
+		vector<shared_ptr<Edge> > &edges1,
+		Matrix<double, 4, 14> &verts1,
+		MatrixXd &faceNors1,
+		MatrixXd &vertNors1,
+		const Vector3d &whd1,
+		const Matrix4d &E1)
 	{
 		Matrix4d S = Matrix4d::Identity();
 		S(0, 0) = 0.5*whd1(0);
@@ -485,6 +512,39 @@ namespace btc
 			min1(2) <= max2(2);
 	}
 
+	ClothBVH::ClothBVH() :
+		bounds(Matrix<double, 6, 1>::Zero()),
+		valid(false)
+	{
+
+	}
+
+	ClothBVH::~ClothBVH()
+	{
+
+	}
+
+	void ClothBVH::update(
+		const MatrixXd &verts2,
+		const MatrixXi &faces2,
+		const vector<shared_ptr<Edge> > &edges2)
+	{
+		build_AABB_B(bounds, verts2);
+		MatrixXd aabbF2(6, faces2.cols());
+		build_AABB_F(aabbF2, verts2, faces2);
+		MatrixXd aabbE2(6, edges2.size());
+		build_AABB_E(aabbE2, verts2, edges2);
+		if (valid && faces.size() == aabbF2.cols() && edges.size() == aabbE2.cols()) {
+			faces.refit(aabbF2);
+			edges.refit(aabbE2);
+		}
+		else {
+			faces.build(aabbF2);
+			edges.build(aabbE2);
+			valid = true;
+		}
+	}
+
 	void barycentric(
 		double &alpha, double &beta,
 		const Vector3d &a, const Vector3d &b, const Vector3d &c,
@@ -600,7 +660,7 @@ namespace btc
 	}
 
 	void boxTriCollision(
-		vector<shared_ptr<Collision> > &collisions,
+		vector<Collision> &collisions,
 		double threshold,
 		const Vector3d &whd1,
 		const Matrix4d &E1,
@@ -615,66 +675,69 @@ namespace btc
 	}
 
 	void boxTriCollision(
-		vector<shared_ptr<Collision> > &collisions,
+		vector<Collision> &collisions,
 		double threshold,
 		const Vector3d &whd1,
 		const Matrix4d &E1,
 		const MatrixXd &verts2_,
 		const MatrixXi &faces2,
-		const VectorXi &isEOL2_,
+		const VectorXi &isEOL2,
 		bool EOL,
 		const vector<shared_ptr<Edge> > &edges2)
 	{
-		// Make a copy first so we can perturb
-		MatrixXd verts2 = verts2_;
-
-		// Assume isEOL=false by default
-		VectorXi isEOL2(verts2.cols());
-		if (isEOL2_.size() == verts2.cols()) {
-			for (int i2 = 0; i2 < verts2.cols(); ++i2) {
-				isEOL2(i2) = isEOL2_(i2);
-			}
-		}
-		else {
-			for (int i2 = 0; i2 < verts2.cols(); ++i2) {
-				isEOL2(i2) = 0;
-			}
-		}
+		MatrixXd verts2;
+		perturbVerts(verts2, verts2_, createJitter(verts2_.cols()), threshold);
+		MatrixXd faceNors2 = createFaceNormals(faces2, verts2);
+		ClothBVH bvh;
+		bvh.update(verts2, faces2, edges2);
+		boxTriCollision(collisions, threshold, whd1, E1, verts2, faceNors2, faces2, EOL, edges2, bvh);
+	}
 
+	void boxTriCollision(
+		vector<Collision> &collisions,
+		double threshold,
+		const Vector3d &whd1,
+		const Matrix4d &E1,
+		const MatrixXd &verts2,
+		const MatrixXd &faceNors2,
+		const MatrixXi &faces2,
+		bool EOL,
+		const vector<shared_ptr<Edge> > &edges2,
+		const ClothBVH &bvh)
+	{
 		// The first body is always the box
 		vector<shared_ptr<Edge> > edges1;
-		createBox(edges1, whd1, E1);
-
-		// Perturb cloth verts
-		std::random_device rd;
-		std::mt19937 gen;
-		std::uniform_real_distribution<> dis(-1.0, 1.0);
-		gen.seed(1);
-		for (int i2 = 0; i2 < verts2.cols(); ++i2) {
-			Vector3d r;
-			r(0) = dis(gen)*threshold*1e-3;
-			r(1) = dis(gen)*threshold*1e-3;
-			r(2) = dis(gen)*threshold*1e-3;
-			verts2.block<3, 1>(0, i2) += r;
-		}
-
-		// Precompute the face normals for the cloth
-		MatrixXd faceNors2 = createFaceNormals(faces2, verts2);
+		Matrix<double, 4, 14> verts1;
+		MatrixXd faceNors1;
+		MatrixXd vertNors1;
+		createBox(edges1, verts1, faceNors1, vertNors1, whd1, E1);
 
 		// Build AABBs
 		Matrix<double, 6, 1> aabbB1;
 		Matrix<double, 6, 1> aabbB2;
 		build_AABB_B(aabbB1, verts1);
-		build_AABB_B(aabbB2, verts2);
+		aabbB2 = bvh.bounds;
 		MatrixXd aabbF1(6, faces1.cols());
 		build_AABB_F(aabbF1, verts1, faces1);
-		MatrixXd aabbE2(6, edges2.size());
-		build_AABB_E(aabbE2, verts2, edges2);
+
+		// The queries are padded by the 1e-3 used by check_AABB on both sides
+		double slack = 2e-3;
+		vector<int> hits;
 
 		// We don't need any vert2-face1 collisions when creating conformal geometry in EOL
 		if (!EOL) {
+			// Cloth verts near the box are the verts of the cloth faces near the box
+			bvh.faces.query(aabbB1.segment<3>(0), aabbB1.segment<3>(3), slack, hits);
+			vector<int> near2;
+			for (int j2 : hits) {
+				near2.push_back(faces2(0, j2));
+				near2.push_back(faces2(1, j2));
+				near2.push_back(faces2(2, j2));
+			}
+			sort(near2.begin(), near2.end());
+			near2.erase(unique(near2.begin(), near2.end()), near2.end());
 			// Vertex2-Triangle1
-			for (int i2 = 0; i2 < verts2.cols(); ++i2) {
+			for (int i2 : near2) {
 				Vector3d x2 = verts2.block<3, 1>(0, i2);
 				// AABB test: check Vertex2 against Body1
 				Matrix<double, 6, 1> aabbV2;
@@ -683,7 +746,8 @@ namespace btc
 				if (!check_AABB(aabbV2, aabbB1)) {
 					continue;
 				}
-				shared_ptr<Collision> cmin = NULL;
+				Collision cmin;
+				bool found = false;
 				// Is this vertex inside Body2? If Body2 is convex, we can verify this
 				// by doing a half-space test on all the triangles from Body2.
 				bool inside = true;
@@ -733,31 +797,32 @@ namespace btc
 						nor2 = -nor2;
 					}
 					// Create contact object
-					auto c = make_shared<Collision>();
-					c->dist = dist;
-					c->nor1 = nor1;
-					c->nor2 = nor2;
-					c->pos1 = x1;
-					c->pos2 = x2;
-					c->count1 = 3;
-					c->count2 = 1;
-					c->verts1 = f1;
-					c->verts2 << i2, -1, -1;
-					c->weights1 << u, v, w;
-					c->weights2 << 1.0, 0.0, 0.0;
-					c->tri1 = j1;
-					c->tri2 = -1;
+					Collision c;
+					c.dist = dist;
+					c.nor1 = nor1;
+					c.nor2 = nor2;
+					c.pos1 = x1;
+					c.pos2 = x2;
+					c.count1 = 3;
+					c.count2 = 1;
+					c.verts1 = f1;
+					c.verts2 << i2, -1, -1;
+					c.weights1 << u, v, w;
+					c.weights2 << 1.0, 0.0, 0.0;
+					c.tri1 = j1;
+					c.tri2 = -1;
 					// Is this the closest one so far?
-					if (cmin == NULL) {
+					if (!found) {
 						cmin = c;
+						found = true;
 					}
 					else {
-						if (c->dist < cmin->dist) {
+						if (c.dist < cmin.dist) {
 							cmin = c;
 						}
 					}
 				}
-				if (cmin != NULL) {
+				if (found) {
 					collisions.push_back(cmin);
 				}
 			}
@@ -777,9 +842,13 @@ namespace btc
 			if (!check_AABB(aabbV1, aabbB2)) {
 				continue;
 			}
-			shared_ptr<Collision> cmin = NULL;
+			Collision cmin;
+			bool found = false;
 			Vector3d nor1 = vertNors1.block<3, 1>(0, i1); // vertex normal
-			for (int j2 = 0; j2 < faces2.cols(); ++j2) {
+			// Only faces within the 5*threshold projection distance can collide
+			hits.clear();
+			bvh.faces.query(x1, x1, 5.0*threshold + slack, hits);
+			for (int j2 : hits) {
 				const Vector3i &f2 = faces2.col(j2);
 				const Vector3d &x2a = verts2.block<3, 1>(0, f2(0));
 				const Vector3d &x2b = verts2.block<3, 1>(0, f2(1));
@@ -812,48 +881,54 @@ namespace btc
 					continue;
 				}
 				// Create contact object
-				auto c = make_shared<Collision>();
-				c->dist = dist;
-				c->nor1 = nor1;
-				c->nor2 = nor2;
-				c->pos1 = x1;
-				c->pos2 = x2;
-				c->count1 = 1;
-				c->count2 = 3;
-				c->verts1 << i1, -1, -1;
-				c->verts2 = f2;
-				c->weights1 << 1.0, 0.0, 0.0;
-				c->weights2 << u, v, w;
-				c->edge1.push_back(vertEdges1(0, i1));
-				c->edge1.push_back(vertEdges1(1, i1));
-				c->edge1.push_back(vertEdges1(2, i1));
-				c->tri1 = -1;
-				c->tri2 = j2;
+				Collision c;
+				c.dist = dist;
+				c.nor1 = nor1;
+				c.nor2 = nor2;
+				c.pos1 = x1;
+				c.pos2 = x2;
+				c.count1 = 1;
+				c.count2 = 3;
+				c.verts1 << i1, -1, -1;
+				c.verts2 = f2;
+				c.weights1 << 1.0, 0.0, 0.0;
+				c.weights2 << u, v, w;
+				c.addEdge1(vertEdges1(0, i1));
+				c.addEdge1(vertEdges1(1, i1));
+				c.addEdge1(vertEdges1(2, i1));
+				c.tri1 = -1;
+				c.tri2 = j2;
 				// Is this the closest one so far?
-				if (cmin == NULL) {
+				if (!found) {
 					cmin = c;
+					found = true;
 				}
 				else {
-					if (c->dist < cmin->dist) {
+					if (c.dist < cmin.dist) {
 						cmin = c;
 					}
 				}
 			}
-			if (cmin != NULL) {
+			if (found) {
 				collisions.push_back(cmin);
 			}
 		}
 		nFaceCol = collisions.size() - nVertCol;
 
 		// Edge2-Edge1
-		for (int k2 = 0; k2 < edges2.size(); ++k2) {
+		// Every box face AABB is inside the box AABB, so this keeps every edge passing the check_AABB below
+		hits.clear();
+		bvh.edges.query(aabbB1.segment<3>(0), aabbB1.segment<3>(3), slack, hits);
+		for (int k2 : hits) {
 			auto e2 = edges2[k2];
 			const Vector3d &x2a = verts2.block<3, 1>(0, e2->verts(0));
 			const Vector3d &x2b = verts2.block<3, 1>(0, e2->verts(1));
 			Vector3d dx2 = x2b - x2a;
 			double len2 = dx2.norm();
 			Vector3d nor2 = (e2->normals[0] + e2->normals[1]).normalized();
-			Matrix<double, 6, 1> aabbE2k = aabbE2.col(k2);
+			Matrix<double, 6, 1> aabbE2k;
+			aabbE2k.segment<3>(0) = x2a.cwiseMin(x2b);
+			aabbE2k.segment<3>(3) = x2a.cwiseMax(x2b);
 			for (int k1 = 0; k1 < edges1.size(); ++k1) {
 				auto e1 = edges1[k1];
 				if (e1->angle < M_PI / 6.0) {
@@ -997,21 +1072,21 @@ namespace btc
 				if (dx.dot(dx) > thresh*thresh) {
 					continue;
 				}
-				auto c = make_shared<Collision>();
-				c->dist = dx.norm();
-				c->nor1 = nor1;
-				c->nor2 = nor;
-				c->pos1 = x1;
-				c->pos2 = x2;
-				c->count1 = 2;
-				c->count2 = 2;
-				c->verts1 << e1->verts.segment<2>(0), -1;
-				c->verts2 << e2->verts.segment<2>(0), -1;
-				c->weights1 << 1.0 - u1, u1, 0.0;
-				c->weights2 << 1.0 - u2, u2, 0.0;
-				c->edge1.push_back(k1);
-				c->edge2 = k2;
-				c->edgeDir = tan1;
+				Collision c;
+				c.dist = dx.norm();
+				c.nor1 = nor1;
+				c.nor2 = nor;
+				c.pos1 = x1;
+				c.pos2 = x2;
+				c.count1 = 2;
+				c.count2 = 2;
+				c.verts1 << e1->verts.segment<2>(0), -1;
+				c.verts2 << e2->verts.segment<2>(0), -1;
+				c.weights1 << 1.0 - u1, u1, 0.0;
+				c.weights2 << 1.0 - u2, u2, 0.0;
+				c.addEdge1(k1);
+				c.edge2 = k2;
+				c.edgeDir = tan1;
 				collisions.push_back(c);
 			}
 		}
@@ -1025,8 +1100,8 @@ namespace btc
 			int kmin = -1;
 			double dmin = 1e9;
 			for (int k = 0; k < collisions.size(); ++k) {
-				if (collisions[k]->count1 == 1 && collisions[k]->verts1(0) == i1) {
-					const Vector3d &x2 = collisions[k]->pos2;
+				if (collisions[k].count1 == 1 && collisions[k].verts1(0) == i1) {
+					const Vector3d &x2 = collisions[k].pos2;
 					Vector3d dx = x2 - x1;
 					double d = dx.dot(dx);
 					if (d < dmin) {
@@ -1039,7 +1114,7 @@ namespace btc
 				// Make a list of collisions to delete
 				vector<int> dlist;
 				for (int k = 0; k < collisions.size(); ++k) {
-					if (collisions[k]->count1 == 1 && collisions[k]->verts1(0) == i1 && k != kmin) {
+					if (collisions[k].count1 == 1 && collisions[k].verts1(0) == i1 && k != kmin) {
 						dlist.push_back(k);
 					}
 				}
@@ -1055,8 +1130,8 @@ namespace btc
 		// collision on the box offset by a small amount so that it is inside the
 		// box.
 		double snapDepth = 0.1*threshold;
-		for (auto collision : collisions) {
-			collision->pos1_ = collision->pos1 - snapDepth*collision->nor1;
+		for (auto &collision : collisions) {
+			collision.pos1_ = collision.pos1 - snapDepth*collision.nor1;
 		}
 
 		return;
@@ -1065,7 +1140,7 @@ namespace btc
 	///////////////////////////////////////////////////////////////////////////////
 
 	void pointTriCollision(
-		vector<shared_ptr<Collision> > &collisions,
+		vector<Collision> &collisions,
 		double threshold,
 		const Eigen::MatrixXd &verts1,
 		const Eigen::MatrixXd &norms1,
@@ -1073,66 +1148,91 @@ namespace btc
 		const Eigen::MatrixXi &faces2,
 		bool EOL)
 	{
-		// Make a copy first so we can perturb
-		MatrixXd verts2 = verts2_;
-
-		// Perturb cloth verts
-		std::random_device rd;
-		std::mt19937 gen;
-		std::uniform_real_distribution<> dis(-1.0, 1.0);
-		gen.seed(1);
-		for (int i2 = 0; i2 < verts2.cols(); ++i2) {
-			Vector3d r;
-			r(0) = dis(gen)*threshold*1e-3;
-			r(1) = dis(gen)*threshold*1e-3;
-			r(2) = dis(gen)*threshold*1e-3;
-			verts2.block<3, 1>(0, i2) += r;
-		}
-
-		// Precompute the face normals for the cloth
+		MatrixXd verts2;
+		perturbVerts(verts2, verts2_, createJitter(verts2_.cols()), threshold);
 		MatrixXd faceNors2 = createFaceNormals(faces2, verts2);
+		// Only the face tree is needed here
+		ClothBVH bvh;
+		MatrixXd aabbF2(6, faces2.cols());
+		build_AABB_F(aabbF2, verts2, faces2);
+		bvh.faces.build(aabbF2);
+		build_AABB_B(bvh.bounds, verts2);
+		pointTriCollision(collisions, threshold, verts1, norms1, verts2, faceNors2, faces2, EOL, bvh);
+	}
 
-		// Build AABBs
-		Matrix<double, 6, 1> aabbB2;
-		build_AABB_B(aabbB2, verts2);
+	void pointTriCollision(
+		vector<Collision> &collisions,
+		double threshold,
+		const Eigen::MatrixXd &verts1,
+		const Eigen::MatrixXd &norms1,
+		const Eigen::MatrixXd &verts2,
+		const Eigen::MatrixXd &faceNors2,
+		const Eigen::MatrixXi &faces2,
+		bool EOL,
+		const ClothBVH &bvh)
+	{
+		const Matrix<double, 6, 1> &aabbB2 = bvh.bounds;
+
+		// The queries are padded by the 1e-3 used by check_AABB on both sides
+		double slack = 2e-3;
+		vector<int> hits;
 
 		if (EOL) {
-			for (int i2 = 0; i2 < verts2.cols(); ++i2) {
+			// Gather the (cloth vert, point) pairs from the faces near every point,
+			// then visit them in the same order as a loop over all the cloth verts and points
+			vector<pair<int, int> > pairs;
+			for (int i1 = 0; i1 < verts1.cols(); ++i1) {
+				Vector3d x1 = verts1.block<3, 1>(0, i1);
+				hits.clear();
+				bvh.faces.query(x1, x1, threshold + slack, hits);
+				for (int j2 : hits) {
+					for (int i = 0; i < 3; ++i) {
+						pairs.push_back(make_pair(faces2(i, j2), i1));
+					}
+				}
+			}
+			sort(pairs.begin(), pairs.end());
+			pairs.erase(unique(pairs.begin(), pairs.end()), pairs.end());
+			for (int p = 0; p < pairs.size();) {
+				int i2 = pairs[p].first;
 				Vector3d x2 = verts2.block<3, 1>(0, i2);
-				shared_ptr<Collision> cmin = NULL;
-				for (int i1 = 0; i1 < verts1.cols(); ++i1) {
+				Collision cmin;
+				bool found = false;
+				for (; p < pairs.size() && pairs[p].first == i2; ++p) {
+					int i1 = pairs[p].second;
 					Vector3d x1 = verts1.block<3, 1>(0, i1);
 					Vector3d dx = x2 - x1;
 					double dist = dx.norm();
 					if (dist < threshold) {
 						Vector3d nor1 = norms1.block<3, 1>(0, i1); // vertex normal
 						// Create contact object
-						auto c = make_shared<Collision>();
-						c->dist = dist;
-						c->nor1 = nor1;
-						c->nor2 = nor1; // We don't care so hack
-						c->pos1 = x1;
-						c->pos2 = x2;
-						c->count1 = 3;
-						c->count2 = 1;
-						c->verts1 << i1, -1, -1;
-						c->verts2 << i2, -1, -1;
-						c->weights1 << 1.0, 0.0, 0.0;
-						c->weights2 << 1.0, 0.0, 0.0;
-						c->tri1 = -1;
-						c->tri2 = -1;
+						Collision c;
+						c.dist = dist;
+						c.nor1 = nor1;
+						c.nor2 = nor1; // We don't care so hack
+						c.pos1 = x1;
+						c.pos2 = x2;
+						c.count1 = 3;
+						c.count2 = 1;
+						c.verts1 << i1, -1, -1;
+						c.verts2 << i2, -1, -1;
+						c.weights1 << 1.0, 0.0, 0.0;
+						c.weights2 << 1.0, 0.0, 0.0;
+						c.tri1 = -1;
+						c.tri2 = -1;
 						// Is this the closest one so far?
-						if (cmin == NULL) {
+						if (!found) {
 							cmin = c;
+							found = true;
 						}
 						else {
-							if (c->dist < cmin->dist) {
+							if (c.dist < cmin.dist) {
 								cmin = c;
 							}
 						}
 					}
 				}
-				if (cmin != NULL) {
+				if (found) {
 					collisions.push_back(cmin);
 				}
 			}
@@ -1148,9 +1248,13 @@ namespace btc
 			if (!check_AABB(aabbV1, aabbB2)) {
 				continue;
 			}
-			shared_ptr<Collision> cmin = NULL;
+			Collision cmin;
+			bool found = false;
 			Vector3d nor1 = norms1.block<3, 1>(0, i1); // vertex normal
-			for (int j2 = 0; j2 < faces2.cols(); ++j2) {
+			// Only faces within the 5*threshold projection distance can collide
+			hits.clear();
+			bvh.faces.query(x1, x1, 5.0*threshold + slack, hits);
+			for (int j2 : hits) {
 				const Vector3i &f2 = faces2.col(j2);
 				const Vector3d &x2a = verts2.block<3, 1>(0, f2(0));
 				const Vector3d &x2b = verts2.block<3, 1>(0, f2(1));
@@ -1183,31 +1287,32 @@ namespace btc
 					continue;
 				}
 				// Create contact object
-				auto c = make_shared<Collision>();
-				c->dist = dist;
-				c->nor1 = nor1;
-				c->nor2 = nor2;
-				c->pos1 = x1;
-				c->pos2 = x2;
-				c->count1 = 1;
-				c->count2 = 3;
-				c->verts1 << i1, -1, -1;
-				c->verts2 = f2;
-				c->weights1 << 1.0, 0.0, 0.0;
-				c->weights2 << u, v, w;
-				c->tri1 = -1;
-				c->tri2 = j2;
+				Collision c;
+				c.dist = dist;
+				c.nor1 = nor1;
+				c.nor2 = nor2;
+				c.pos1 = x1;
+				c.pos2 = x2;
+				c.count1 = 1;
+				c.count2 = 3;
+				c.verts1 << i1, -1, -1;
+				c.verts2 = f2;
+				c.weights1 << 1.0, 0.0, 0.0;
+				c.weights2 << u, v, w;
+				c.tri1 = -1;
+				c.tri2 = j2;
 				// Is this the closest one so far?
-				if (cmin == NULL) {
+				if (!found) {
 					cmin = c;
+					found = true;
 				}
 				else {
-					if (c->dist < cmin->dist) {
+					if (c.dist < cmin.dist) {
 						cmin = c;
 					}
 				}
 			}
-			if (cmin != NULL) {
+			if (found) {
 				collisions.push_back(cmin);
 			}
 		}
@@ -1216,8 +1321,8 @@ namespace btc
 		// collision on the box offset by a small amount so that it is inside the
 		// box.
 		double snapDepth = 0.1*threshold;
-		for (auto collision : collisions) {
-			collision->pos1_ = collision->pos1 - snapDepth*collision->nor1;
+		for (auto &collision : collisions) {
+			collision.pos1_ = collision.pos1 - snapDepth*collision.nor1;
 		}
 
 		return;
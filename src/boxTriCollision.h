@@ -2,11 +2,14 @@
 #ifndef BOXTRICOLLISION_H_
 #define BOXTRICOLLISION_H_
 
+#include <cassert>
 #include <memory>
 #include <vector>
 #define EIGEN_DONT_ALIGN_STATICALLY
 #include <Eigen/Dense>
 
+#include "BVH.h"
+
 // Throughout this code, `1` refers to the box and `2` refers to the cloth.
 // For example, `pos1` is the collision point on the box, and `pos2` is the
 // collision point on the cloth.
@@ -46,11 +49,60 @@ namespace btc
 		const Eigen::MatrixXd &verts  // input
 	);
 
+	// Unit normal of every face, (xb - xa) x (xc - xa)
+	Eigen::MatrixXd createFaceNormals(
+		const Eigen::MatrixXi &faces,
+		const Eigen::MatrixXd &verts);
+
+	/**
+	* Unit offsets in [-1, 1] for every cloth vertex. Before the narrow phase
+	* the cloth verts are moved by 1e-3*threshold times these so that contacts
+	* are never exactly degenerate. The table only depends on the number of
+	* verts and the seed, so it can be kept until the topology changes.
+	*/
+	Eigen::MatrixXd createJitter(int nverts, unsigned int seed = 1);
+
+	// pverts = verts + 1e-3*threshold*jitter
+	void perturbVerts(
+		Eigen::MatrixXd &pverts,
+		const Eigen::MatrixXd &verts,
+		const Eigen::MatrixXd &jitter,
+		double threshold);
+
+	/**
+	* Broad phase for the cloth, one tree over the faces and one over the
+	* edges from createEdges. The trees are rebuilt after invalidate() or when
+	* the number of faces or edges changes, and are only refit otherwise.
+	*/
+	class ClothBVH
+	{
+	public:
+		ClothBVH();
+		virtual ~ClothBVH();
+
+		BVH faces;
+		BVH edges;
+		Eigen::Matrix<double, 6, 1> bounds; // AABB of all the verts
+
+		void update(
+			const Eigen::MatrixXd &verts2,
+			const Eigen::MatrixXi &faces2,
+			const std::vector<std::shared_ptr<Edge> > &edges2);
+		// Call whenever the cloth topology changes
+		void invalidate() { valid = false; }
+
+	private:
+		bool valid;
+	};
+
+	/**
+	* Contacts are plain values with no heap storage, so collision lists can be
+	* kept and cleared between steps without touching the allocator.
+	*/
 	class Collision
 	{
 	public:
 		Collision();
-		virtual ~Collision();
 
 		// The collision can be Vert-Face, Face-Vert, or Edge-Edge.
 		// Vert-Face:
@@ -104,9 +156,12 @@ namespace btc
 		Eigen::Vector3d weights2; // The vertex weights on cloth
 		int tri1; // Triangle index for box
 		int tri2; // Triangle index for cloth
-		std::vector<int> edge1; // all surrounding edge indices for he box
+		int edge1[3]; // all surrounding edge indices for he box
+		int nedge1; // Number of entries used in edge1
 		int edge2; // edge index for cloth
 		Eigen::Vector3d edgeDir; // Direction of box edge TODO:: This a better way
+
+		void addEdge1(int e) { assert(nedge1 < 3); edge1[nedge1++] = e; }
 	};
 
 	/**
@@ -121,7 +176,7 @@ namespace btc
 	*   faces2: 3xm matrix of cloth faces
 	*/
 	void boxTriCollision(
-		std::vector<std::shared_ptr<Collision> > &collisions,
+		std::vector<Collision> &collisions,
 		double threshold,
 		const Eigen::Vector3d &whd1,
 		const Eigen::Matrix4d &E1,
@@ -136,7 +191,7 @@ namespace btc
 	* above, which creates the edge structure based on verts2 and faces2.
 	*/
 	void boxTriCollision(
-		std::vector<std::shared_ptr<Collision> > &collisions,
+		std::vector<Collision> &collisions,
 		double threshold,
 		const Eigen::Vector3d &whd1,
 		const Eigen::Matrix4d &E1,
@@ -146,10 +201,28 @@ namespace btc
 		bool EOL,
 		const std::vector<std::shared_ptr<Edge> > &edges2);
 
+	/**
+	* Same as above, but nothing is copied or perturbed here. verts2 must
+	* already be perturbed with perturbVerts, faceNors2 are its face normals,
+	* and bvh must be up to date with it. The narrow phase only visits the
+	* cloth faces and edges found by bvh.
+	*/
+	void boxTriCollision(
+		std::vector<Collision> &collisions,
+		double threshold,
+		const Eigen::Vector3d &whd1,
+		const Eigen::Matrix4d &E1,
+		const Eigen::MatrixXd &verts2,
+		const Eigen::MatrixXd &faceNors2,
+		const Eigen::MatrixXi &faces2,
+		bool EOL,
+		const std::vector<std::shared_ptr<Edge> > &edges2,
+		const ClothBVH &bvh);
+
 	///////////////////////////////////////////////////////////////////////////////
 
 	void pointTriCollision(
-		std::vector<std::shared_ptr<Collision> > &collisions,
+		std::vector<Collision> &collisions,
 		double threshold,
 		const Eigen::MatrixXd &verts1,
 		const Eigen::MatrixXd &norms1,
@@ -157,6 +230,18 @@ namespace btc
 		const Eigen::MatrixXi &faces2,
 		bool EOL);
 
+	// Same as above with perturbed verts2 and the trees, like the boxTriCollision overload taking bvh
+	void pointTriCollision(
+		std::vector<Collision> &collisions,
+		double threshold,
+		const Eigen::MatrixXd &verts1,
+		const Eigen::MatrixXd &norms1,
+		const Eigen::MatrixXd &verts2,
+		const Eigen::MatrixXd &faceNors2,
+		const Eigen::MatrixXi &faces2,
+		bool EOL,
+		const ClothBVH &bvh);
+
 }
 
 #endif
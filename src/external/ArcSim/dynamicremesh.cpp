@@ -41,6 +41,7 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <algorithm>
 #include <cstdlib>
 #include <map>
+#include <thread>
 using namespace std;
 
 static const bool verbose = false;
@@ -244,23 +245,61 @@ Mat3x3 compute_face_sizing(Remeshing& remeshing, const Face *face) {
 	return UV * s * UVt; // reproject to 3D
 }
 
+// Runs work(t, begin, end) over n items split into contiguous ranges, one per thread
+template <typename Work> static void parallel_ranges(int n, int threads, const Work &work) {
+	int nthreads = threads > 0 ? threads : max((int)thread::hardware_concurrency(), 1);
+	nthreads = max(min(nthreads, n), 1);
+	vector<thread> workers;
+	for (int t = 1; t < nthreads; t++)
+		workers.push_back(thread(work, t, (long long)n * t / nthreads, (long long)n * (t + 1) / nthreads));
+	work(0, 0, (long long)n / nthreads);
+	for (size_t t = 0; t < workers.size(); t++)
+		workers[t].join();
+}
+
+// Batches of remeshing ops smaller than this are built on the calling thread
+static const int min_parallel_ops = 64;
+
+static int parallel_threads(const Mesh &mesh, int nops) {
+	return nops < min_parallel_ops ? 1 : mesh.parent->remeshing.threads;
+}
+
 void create_vert_sizing(vector<Vert*>& verts) {
-	Remeshing& remeshing = verts[0]->node->mesh->parent->remeshing;
-	map<Face*, Mat3x3> face_sizing;
-	for (size_t i = 0; i<verts.size(); i++) {
-		Mat3x3 sizing(0);
-		Vert* vert = verts[i];
-		double wsum = 0;
-		for (size_t f = 0; f<vert->adjf.size(); f++) {
-			Face *face = vert->adjf[f];
-			if (!face) continue;
-			if (face_sizing.find(face) == face_sizing.end())
-				face_sizing[face] = compute_face_sizing(remeshing, face);
-			sizing += face->a * face_sizing[face];
-			wsum += face->a;
+	Mesh& mesh = *verts[0]->node->mesh;
+	Remeshing& remeshing = mesh.parent->remeshing;
+	// Every face around the verts is sized once into its slot by face index,
+	// then each vert sums its faces in adjf order, so the result doesn't depend on the thread count
+	for (size_t f = 0; f < mesh.faces.size(); f++)
+		mesh.faces[f]->index = f;
+	vector<char> needed(mesh.faces.size(), 0);
+	vector<Face*> faces;
+	for (size_t i = 0; i < verts.size(); i++) {
+		for (size_t f = 0; f < verts[i]->adjf.size(); f++) {
+			Face *face = verts[i]->adjf[f];
+			if (!face || needed[face->index]) continue;
+			needed[face->index] = 1;
+			faces.push_back(face);
 		}
-		vert->sizing = sizing / wsum;
 	}
+	vector<Mat3x3> face_sizing(mesh.faces.size());
+	parallel_ranges(faces.size(), remeshing.threads, [&](int t, int begin, int end) {
+		for (int f = begin; f < end; f++)
+			face_sizing[faces[f]->index] = compute_face_sizing(remeshing, faces[f]);
+	});
+	parallel_ranges(verts.size(), remeshing.threads, [&](int t, int begin, int end) {
+		for (int i = begin; i < end; i++) {
+			Mat3x3 sizing(0);
+			Vert* vert = verts[i];
+			double wsum = 0;
+			for (size_t f = 0; f < vert->adjf.size(); f++) {
+				Face *face = vert->adjf[f];
+				if (!face) continue;
+				sizing += face->a * face_sizing[face->index];
+				wsum += face->a;
+			}
+			vert->sizing = sizing / wsum;
+		}
+	});
 }
 
 double edge_metric(const Vert *vert0, const Vert *vert1) {
@@ -288,8 +327,19 @@ bool flip_some_edges(MeshSubset* subset, vector<Face*>& active_faces,
 
 	bool did_flip = false;
 	n_edges_prev = edges.size();
-	for (size_t e = 0; e < edges.size(); e++) {
-		RemeshOp op = flip_edge(edges[e]);
+	if (edges.empty())
+		return false;
+	// The edges share no node, so their flips touch disjoint faces and can be built concurrently,
+	// then applied in edge order which gives the same mesh as flipping them one by one
+	Mesh& mesh = *edges[0]->n[0]->mesh;
+	vector<RemeshOp> ops(edges.size());
+	parallel_ranges(edges.size(), parallel_threads(mesh, edges.size()), [&](int t, int begin, int end) {
+		for (int e = begin; e < end; e++)
+			ops[e] = build_flip_edge(edges[e]);
+	});
+	apply_all(ops, mesh);
+	for (size_t e = 0; e < ops.size(); e++) {
+		RemeshOp &op = ops[e];
 		if (op.empty()) continue;
 
 		did_flip = true;
@@ -300,8 +350,8 @@ bool flip_some_edges(MeshSubset* subset, vector<Face*>& active_faces,
 		if (update_faces)
 			op.update(*update_faces);
 		op.update(active_faces);
-		op.done();
 	}
+	done_all(ops);
 	return did_flip;
 }
 
@@ -394,8 +444,16 @@ vector<Edge*> find_bad_edges(const vector<Edge*>& edges);
 
 Vert *adjacent_vert(const Node *node, const Vert *vert);
 
+void split_independent_edges(MeshSubset* subset, vector<Edge*>& bad_edges);
+
 bool split_worst_edge(MeshSubset* subset, const vector<Edge*>& edges) {
 	vector<Edge*> bad_edges = find_bad_edges(edges);
+	if (bad_edges.empty())
+		return false;
+	if (bad_edges[0]->n[0]->mesh->parent->remeshing.threads != 1) {
+		split_independent_edges(subset, bad_edges);
+		return true;
+	}
 	for (size_t e = 0; e < bad_edges.size(); e++) {
 		Edge *edge = bad_edges[e];
 		if (!edge) continue;
@@ -419,6 +477,66 @@ bool split_worst_edge(MeshSubset* subset, const vector<Edge*>& edges) {
 	return !bad_edges.empty();
 }
 
+// Splits the bad edges in rounds, each taking the worst remaining edges that share no face with each other
+// A round's ops are built on worker threads, then applied in bad edge order with their node uuids handed out in
+// that order, so the result doesn't depend on the thread count. The fix-up flips run once per round instead of
+// after every split, so the serial path is kept when remeshing threads is 1
+void split_independent_edges(MeshSubset* subset, vector<Edge*>& bad_edges) {
+	Mesh& mesh = *bad_edges[0]->n[0]->mesh;
+	while (true) {
+		vector<char> taken(mesh.faces.size(), 0);
+		vector<Edge*> round;
+		for (size_t e = 0; e < bad_edges.size(); e++) {
+			Edge *edge = bad_edges[e];
+			if (!edge) continue;
+			Face *f0 = edge->adjf[0], *f1 = edge->adjf[1];
+			if ((f0 && taken[f0->index]) || (f1 && taken[f1->index]))
+				continue;
+			if (f0) taken[f0->index] = 1;
+			if (f1) taken[f1->index] = 1;
+			round.push_back(edge);
+			// Also drops the edges whose split is cancelled, so every edge is tried once
+			bad_edges[e] = 0;
+		}
+		if (round.empty())
+			return;
+
+		vector<RemeshOp> built(round.size());
+		parallel_ranges(round.size(), parallel_threads(mesh, round.size()), [&](int t, int begin, int end) {
+			for (int e = begin; e < end; e++)
+				built[e] = build_split_edge(round[e], 0.5);
+		});
+		vector<RemeshOp> ops;
+		vector<Edge*> split;
+		for (size_t e = 0; e < built.size(); e++) {
+			if (built[e].added_nodes.empty()) continue;
+			for (size_t n = 0; n < built[e].added_nodes.size(); n++)
+				built[e].added_nodes[n]->uuid = uuid_src++;
+			ops.push_back(built[e]);
+			split.push_back(round[e]);
+		}
+		apply_all(ops, mesh);
+
+		vector<Face*> active;
+		for (size_t o = 0; o < ops.size(); o++) {
+			RemeshOp &op = ops[o];
+			Node *node0 = split[o]->n[0], *node1 = split[o]->n[1];
+			for (size_t v = 0; v < op.added_verts.size(); v++) {
+				Vert *vertnew = op.added_verts[v];
+				Vert *v0 = adjacent_vert(node0, vertnew),
+					*v1 = adjacent_vert(node1, vertnew);
+				vertnew->sizing = 0.5 * (v0->sizing + v1->sizing);
+			}
+			if (subset)
+				op.update(subset->active_nodes);
+			op.set_null(bad_edges);
+			append(active, op.added_faces);
+		}
+		done_all(ops);
+		flip_edges(subset, active, &bad_edges, 0);
+	}
+}
+
 // don't use edge pointer as secondary sort key, otherwise not reproducible
 struct Deterministic_sort {
 	inline bool operator()(const std::pair<double, Edge*> &left, const std::pair<double, Edge*> &right) {
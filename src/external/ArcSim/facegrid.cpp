@@ -0,0 +1,44 @@
+// NICK
+
+#include "facegrid.hpp"
+#include "geometry.hpp"
+
+using namespace std;
+
+bool MeshFaceAccess::inside(const Vec2& u, const Face* face) const {
+	return is_inside(u, face);
+}
+
+Vec3 MeshFaceAccess::barycentric(const Vec2& u, const Face* face) const {
+	return get_barycentric_coords(u, face);
+}
+
+void FaceGrid::build(const vector<Face*>& faces) {
+	// Every face's cells are recorded so Mesh::remove can erase it before the face is deleted
+	ranges.clear();
+	ranges.reserve(faces.size());
+	layout(faces.size(), [&](int f) { return faces[f]; });
+	for (size_t f = 0; f < faces.size(); f++)
+		ranges[faces[f]] = insert(faces[f]);
+}
+
+void FaceGrid::add(Face* face) {
+	if (cells.empty()) return;
+	ranges[face] = insert(face);
+}
+
+void FaceGrid::remove(Face* face) {
+	unordered_map<Face*, CellRange>::iterator it = ranges.find(face);
+	if (it == ranges.end()) return;
+	erase(face, it->second);
+	ranges.erase(it);
+}
+
+void build_face_grid(Mesh& mesh) {
+	if (!mesh.grid) mesh.grid = make_shared<FaceGrid>();
+	mesh.grid->build(mesh.faces);
+}
+
+Face* walk_to_enclosing_face(const Vec2& u, Face* start, int max_steps) {
+	return walk_to_enclosing_face(u, start, max_steps, MeshFaceAccess());
+}
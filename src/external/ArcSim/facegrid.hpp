@@ -0,0 +1,245 @@
+// NICK
+// Material space lookups shared by the live mesh and MeshSnapshot
+// The grid and the walk only see faces through an accessor, so the same code runs on Face pointers
+// and on the flat face indices of a snapshot. An accessor provides
+//   FaceRef none() const                        the null face
+//   Vec2 corner(FaceRef f, int i) const         material coordinates of the i-th corner
+//   bool inside(const Vec2& u, FaceRef f) const
+//   Vec3 barycentric(const Vec2& u, FaceRef f) const
+//   FaceRef across(FaceRef f, int i) const      the face across the edge opposite the i-th corner, or none()
+
+#ifndef FACEGRID_HPP
+#define FACEGRID_HPP
+
+#include "mesh.hpp"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Uniform grid over the material space bounds of a set of faces
+// The grid is only a filter and every candidate is still confirmed with inside
+// Faces hold no ownership, a face must be erased before it is deleted
+template <typename FaceRef, typename Access>
+struct MaterialGrid {
+	struct CellRange {
+		int i0, j0, i1, j1;
+	};
+
+	Access access;
+	Vec2 lo;
+	double cell;
+	int nx, ny;
+	std::vector<std::vector<FaceRef> > cells;
+
+	MaterialGrid() : lo(0), cell(1), nx(0), ny(0) {}
+
+	// Sizes the grid to the faces at(0) .. at(n - 1) and inserts them
+	template <typename FaceAt> void build(int n, const FaceAt& at) {
+		layout(n, at);
+		for (int f = 0; f < n; f++)
+			insert(at(f));
+	}
+
+	// Sizes the grid to the faces at(0) .. at(n - 1) and leaves every cell empty
+	// Cells keep their capacity when the grid is rebuilt at a similar size
+	template <typename FaceAt> void layout(int n, const FaceAt& at) {
+		for (size_t c = 0; c < cells.size(); c++)
+			cells[c].clear();
+		if (n == 0) {
+			cells.clear();
+			nx = ny = 0;
+			return;
+		}
+
+		Vec2 hi;
+		lo = access.corner(at(0), 0);
+		hi = lo;
+		double asum = 0;
+		for (int f = 0; f < n; f++) {
+			Vec2 u[3];
+			for (int i = 0; i < 3; i++) {
+				u[i] = access.corner(at(f), i);
+				lo[0] = std::min(lo[0], u[i][0]);
+				lo[1] = std::min(lo[1], u[i][1]);
+				hi[0] = std::max(hi[0], u[i][0]);
+				hi[1] = std::max(hi[1], u[i][1]);
+			}
+			asum += 0.5 * fabs((u[1][0] - u[0][0]) * (u[2][1] - u[0][1]) - (u[1][1] - u[0][1]) * (u[2][0] - u[0][0]));
+		}
+
+		// Roughly one to two faces per cell
+		cell = sqrt(2.0 * asum / n);
+		double w = std::max(hi[0] - lo[0], hi[1] - lo[1]);
+		if (!(cell > 0)) cell = w > 0 ? w : 1.0;
+		cell = std::max(cell, w / 1024.0);
+		nx = std::max((int)ceil((hi[0] - lo[0]) / cell), 1);
+		ny = std::max((int)ceil((hi[1] - lo[1]) / cell), 1);
+
+		cells.resize(nx * ny);
+	}
+
+	// Returns the cells the face went into, which are needed to erase it once its corners are gone
+	CellRange insert(FaceRef face) {
+		CellRange r = range(face);
+		if (cells.empty()) return r;
+		for (int j = r.j0; j <= r.j1; j++)
+			for (int i = r.i0; i <= r.i1; i++)
+				cells[j * nx + i].push_back(face);
+		return r;
+	}
+
+	void erase(FaceRef face, const CellRange& r) {
+		for (int j = r.j0; j <= r.j1; j++) {
+			for (int i = r.i0; i <= r.i1; i++) {
+				std::vector<FaceRef>& c = cells[j * nx + i];
+				for (size_t k = 0; k < c.size(); k++) {
+					if (c[k] == face) {
+						c[k] = c.back();
+						c.pop_back();
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	FaceRef find(const Vec2& u) const {
+		if (cells.empty()) return access.none();
+		const std::vector<FaceRef>& c = cells[cell_y(u[1]) * nx + cell_x(u[0])];
+		for (size_t k = 0; k < c.size(); k++)
+			if (access.inside(u, c[k]))
+				return c[k];
+		return access.none();
+	}
+
+private:
+	int cell_x(double x) const {
+		return std::min(std::max((int)floor((x - lo[0]) / cell), 0), nx - 1);
+	}
+
+	int cell_y(double y) const {
+		return std::min(std::max((int)floor((y - lo[1]) / cell), 0), ny - 1);
+	}
+
+	CellRange range(FaceRef face) const {
+		// Faces are padded so points that inside accepts just outside a face still land in its cells
+		const double pad = 1e-6;
+		Vec2 u = access.corner(face, 0);
+		double xmin = u[0], xmax = xmin;
+		double ymin = u[1], ymax = ymin;
+		for (int i = 1; i < 3; i++) {
+			u = access.corner(face, i);
+			xmin = std::min(xmin, u[0]);
+			xmax = std::max(xmax, u[0]);
+			ymin = std::min(ymin, u[1]);
+			ymax = std::max(ymax, u[1]);
+		}
+		CellRange r;
+		r.i0 = cell_x(xmin - pad);
+		r.i1 = cell_x(xmax + pad);
+		r.j0 = cell_y(ymin - pad);
+		r.j1 = cell_y(ymax + pad);
+		return r;
+	}
+};
+
+// Walks across adjacent faces towards u, returns none() if it leaves the mesh or runs out of steps
+template <typename FaceRef, typename Access>
+FaceRef walk_to_enclosing_face(const Vec2& u, FaceRef start, int max_steps, const Access& access) {
+	FaceRef face = start;
+	FaceRef prev = access.none();
+	for (int s = 0; s < max_steps && face != access.none(); s++) {
+		if (access.inside(u, face))
+			return face;
+		Vec3 bary = access.barycentric(u, face);
+		// Cross the edge opposite the most negative coordinate
+		int which = 0;
+		for (int i = 1; i < 3; i++)
+			if (bary[i] < bary[which]) which = i;
+		FaceRef next = access.across(face, which);
+		if (next == prev) {
+			// Avoid bouncing between two faces when the point is outside both, try the other negative edge
+			int other = -1;
+			for (int i = 0; i < 3; i++)
+				if (i != which && bary[i] < 0 && (other < 0 || bary[i] < bary[other])) other = i;
+			if (other < 0) return access.none();
+			next = access.across(face, other);
+		}
+		prev = face;
+		face = next;
+	}
+	return access.none();
+}
+
+// Material space hash of points, cells are the size of the matching tolerance
+// so any point within the tolerance of a query is in the query's cell or one of its 8 neighbours
+// The (cell, point) pairs are kept sorted in a flat array, which keeps its capacity between builds
+struct MaterialHash {
+	double cell;
+	std::vector<std::pair<unsigned long long, int> > table;
+
+	MaterialHash(double cell) : cell(cell) {}
+
+	static unsigned long long key(long long i, long long j) {
+		return ((unsigned long long)(i & 0xffffffffLL) << 32) | (unsigned long long)(j & 0xffffffffLL);
+	}
+	long long coord(double x) const { return (long long)floor(x / cell); }
+
+	// Hashes the points at(0) .. at(n - 1)
+	template <typename PointAt> void build(int n, const PointAt& at) {
+		table.resize(n);
+		for (int k = 0; k < n; k++) {
+			Vec2 u = at(k);
+			table[k] = std::make_pair(key(coord(u[0]), coord(u[1])), k);
+		}
+		std::sort(table.begin(), table.end());
+	}
+
+	// Returns the first point closer than the cell size, or -1
+	template <typename PointAt> int find(const Vec2& u, const PointAt& at) const {
+		long long i0 = coord(u[0]), j0 = coord(u[1]);
+		for (long long i = i0 - 1; i <= i0 + 1; i++) {
+			for (long long j = j0 - 1; j <= j0 + 1; j++) {
+				unsigned long long k = key(i, j);
+				std::vector<std::pair<unsigned long long, int> >::const_iterator it =
+					std::lower_bound(table.begin(), table.end(), std::make_pair(k, -1));
+				for (; it != table.end() && it->first == k; ++it) {
+					Vec2 p = at(it->second);
+					if (sqrt(sq(p[0] - u[0]) + sq(p[1] - u[1])) < cell) return it->second;
+				}
+			}
+		}
+		return -1;
+	}
+};
+
+// Accessor for the faces of a live mesh
+struct MeshFaceAccess {
+	Face* none() const { return NULL; }
+	Vec2 corner(const Face* face, int i) const { return Vec2(face->v[i]->u[0], face->v[i]->u[1]); }
+	bool inside(const Vec2& u, const Face* face) const;
+	Vec3 barycentric(const Vec2& u, const Face* face) const;
+	Face* across(const Face* face, int i) const {
+		// adje[i] is opposite v[i]
+		const Edge* edge = face->adje[i];
+		return edge->adjf[0] == face ? edge->adjf[1] : edge->adjf[0];
+	}
+};
+
+// Grid over a mesh's faces, kept up to date by Mesh::add and Mesh::remove
+struct FaceGrid : MaterialGrid<Face*, MeshFaceAccess> {
+	std::unordered_map<Face*, CellRange> ranges; // Where each face was put, so it can be removed after its verts are gone
+
+	void build(const std::vector<Face*>& faces);
+	void add(Face* face);
+	void remove(Face* face);
+};
+
+// Builds, or rebuilds, the grid owned by the mesh
+void build_face_grid(Mesh& mesh);
+
+Face* walk_to_enclosing_face(const Vec2& u, Face* start, int max_steps);
+
+#endif
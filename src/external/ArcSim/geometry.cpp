@@ -25,6 +25,7 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 */
 
 #include "geometry.hpp"
+#include "facegrid.hpp"
 #include <cstdlib>
 
 using namespace std;
@@ -283,6 +284,14 @@ bool is_inside(const Vec2& point, const Face* f) {
 // Gets the face that surrounds point u in material space
 Face* get_enclosing_face(const Mesh& mesh, const Vec2& u,
 	Face *starting_face_hint) {
+	if (starting_face_hint) {
+		Face* face = walk_to_enclosing_face(u, starting_face_hint, 16);
+		if (face) return face;
+	}
+	if (mesh.grid) {
+		Face* face = mesh.grid->find(u);
+		if (face) return face;
+	}
 	for (int f = 0; f < (int)mesh.faces.size(); f++)
 		if (is_inside(u, mesh.faces[f]))
 			return mesh.faces[f];
@@ -55,6 +55,10 @@ double incedent_angle(const Vert* v, const Face* f);
 
 Vec3 get_barycentric_coords(const Vec2 &point, const Face *face);
 
+bool is_inside(const Vec2& point, const Face* f);
+
+// The hint should be a face of the same mesh close to u, it is walked from first
+// Without a hint, or if the walk fails, the mesh's FaceGrid is used when it has one
 Face* get_enclosing_face(const Mesh& mesh, const Vec2& u,
 	Face *starting_face_hint = NULL);
 
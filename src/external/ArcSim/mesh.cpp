@@ -27,12 +27,13 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include "mesh.hpp"
 #include "../../Cloth.h"
 #include "geometry.hpp"
+#include "facegrid.hpp"
 #include "util.hpp"
 #include <assert.h>
 #include <cstdlib>
 using namespace std;
 
-int uuid_src = 0;
+std::atomic<int> uuid_src(0);
 
 template <typename T1, typename T2> void check(const T1 *p1, const T2 *p2,
 	const vector<T2*> &v2) {
@@ -298,7 +299,20 @@ void connect(Vert *vert, Node *node) {
 	include(vert, node->verts);
 }
 
+// Swap-with-last removal at the element's stored index, which keeps the index of the moved element valid
+// Falls back to a search when the index is stale, e.g. after set_indices over several meshes
+template <typename T> static void remove_indexed(T *x, vector<T*> &xs) {
+	int i = x->index;
+	if (i < 0 || i >= (int)xs.size() || xs[i] != x)
+		i = find(x, xs);
+	if (i == -1) return;
+	xs[i] = xs.back();
+	xs[i]->index = i;
+	xs.pop_back();
+}
+
 void Mesh::add(Vert *vert) {
+	topology_stamp++;
 	verts.push_back(vert);
 	vert->node = NULL;
 	vert->adjf.clear();
@@ -311,10 +325,12 @@ void Mesh::remove(Vert* vert) {
 			<< vert->adjf.size() << " faces attached to it." << endl;
 		return;
 	}
-	exclude(vert, verts);
+	remove_indexed(vert, verts);
+	topology_stamp++;
 }
 
 void Mesh::add(Node *node) {
+	topology_stamp++;
 	nodes.push_back(node);
 	node->index = nodes.size() - 1;
 	node->adje.clear();
@@ -322,6 +338,7 @@ void Mesh::add(Node *node) {
 		node->verts[v]->node = node;
 	}
 	node->mesh = this;
+	if (node->EoL) EoL_adjacency.insert(node);
 }
 
 void Mesh::remove(Node* node) {
@@ -330,15 +347,22 @@ void Mesh::remove(Node* node) {
 			<< node->adje.size() << " edges attached to it." << endl;
 		return;
 	}
-	exclude(node, nodes);
+	remove_indexed(node, nodes);
+	topology_stamp++;
+	EoL_adjacency.erase(node);
 }
 
 void Mesh::add(Edge *edge) {
+	topology_stamp++;
 	edges.push_back(edge);
 	edge->adjf[0] = edge->adjf[1] = NULL;
 	edge->index = edges.size() - 1;
 	include(edge, edge->n[0]->adje);
 	include(edge, edge->n[1]->adje);
+	if (edge->preserve) {
+		EoL_adjacency.insert(edge->n[0]);
+		EoL_adjacency.insert(edge->n[1]);
+	}
 }
 
 void Mesh::remove(Edge *edge) {
@@ -348,7 +372,8 @@ void Mesh::remove(Edge *edge) {
 			<< ") attached to it." << endl;
 		return;
 	}
-	exclude(edge, edges);
+	remove_indexed(edge, edges);
+	topology_stamp++;
 	exclude(edge, edge->n[0]->adje);
 	exclude(edge, edge->n[1]->adje);
 }
@@ -363,8 +388,10 @@ void add_edges_if_needed(Mesh &mesh, const Face *face) {
 }
 
 void Mesh::add(Face *face) {
+	topology_stamp++;
 	faces.push_back(face);
 	face->index = faces.size() - 1;
+	if (grid) grid->add(face);
 	// adjacency
 	add_edges_if_needed(*this, face);
 	for (int i = 0; i < 3; i++) {
@@ -378,7 +405,9 @@ void Mesh::add(Face *face) {
 }
 
 void Mesh::remove(Face* face) {
-	exclude(face, faces);
+	remove_indexed(face, faces);
+	topology_stamp++;
+	if (grid) grid->remove(face);
 	// adjacency
 	for (int i = 0; i < 3; i++) {
 		Vert *v0 = face->v[NEXT(i)];
@@ -389,6 +418,14 @@ void Mesh::remove(Face* face) {
 	}
 }
 
+void set_EoL(Node *node, bool EoL) {
+	// A node that loses EoL stays until markPreserve has looked at its edges
+	// A node that isn't in a mesh yet is picked up by Mesh::add
+	if (node->mesh && (EoL || node->EoL)) node->mesh->EoL_adjacency.insert(node);
+	if (node->mesh && EoL != node->EoL) node->mesh->topology_stamp++;
+	node->EoL = EoL;
+}
+
 void set_indices(Mesh &mesh) {
 	for (size_t v = 0; v < mesh.verts.size(); v++)
 		mesh.verts[v]->index = v;
@@ -530,6 +567,8 @@ void delete_mesh(Mesh &mesh) {
 	mesh.nodes.clear();
 	mesh.edges.clear();
 	mesh.faces.clear();
+	mesh.EoL_adjacency.clear();
+	mesh.grid.reset();
 	//if (mesh.proxy)
 	//	delete mesh.proxy;
 	//mesh.proxy = 0;
@@ -29,8 +29,10 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 
 #include "transformation.hpp"
 #include "vectors.hpp"
+#include <atomic>
 #include <utility>
 #include <vector>
+#include <set>
 #include <memory>
 
 struct Serialize;
@@ -45,6 +47,7 @@ struct Material;
 struct ReferenceShape;
 struct Cloth;
 struct Mesh;
+struct FaceGrid;
 
 struct Plane {
 	Plane() {}
@@ -52,7 +55,8 @@ struct Plane {
 	Vec3 x0, n;
 };
 
-extern int uuid_src;
+// Atomic since remeshing ops can be built on worker threads
+extern std::atomic<int> uuid_src;
 
 struct Vert {
 	Vec3 u; // material space
@@ -183,6 +187,15 @@ struct Mesh {
 	std::vector<Node*> nodes;
 	std::vector<Edge*> edges;
 	std::vector<Face*> faces;
+	// NICK: Material space face lookup, kept up to date by add/remove once built with build_face_grid
+	std::shared_ptr<FaceGrid> grid;
+	// Nodes whose edges can be preserved, so markPreserve only has to look around them
+	// Every EoL node, plus any node that lost EoL or got a preserved edge since the last markPreserve
+	// Kept up to date by add/remove and set_EoL
+	std::set<Node*> EoL_adjacency;
+	// Bumped by every add and remove, and by set_EoL when a node's EoL flag changes
+	// Anything cached on the connectivity or the EoL layout only has to be rebuilt when this changes
+	unsigned long long topology_stamp;
 	// These do *not* assume ownership, so no deletion on removal
 	void add(Vert *vert);
 	void add(Node *node);
@@ -193,7 +206,7 @@ struct Mesh {
 	void remove(Edge *edge);
 	void remove(Face *face);
 
-	Mesh() : ref(0), parent(0), EoL_Count(0) {};
+	Mesh() : ref(0), parent(0), EoL_Count(0), topology_stamp(0) {}
 
 	//void serializer(Serialize& s);
 };
@@ -232,6 +245,9 @@ inline Edge *next_edge_cw(const Edge* edge, Node* center);
 inline Face *next_face_ccw(const Edge* edge, Node* center);
 inline Face *next_face_cw(const Edge* edge, Node* center);
 
+// Sets the EoL flag and records the node in its mesh's EoL_adjacency
+void set_EoL(Node *node, bool EoL);
+
 void set_indices(Mesh &mesh);
 void set_indices(std::vector<Mesh*> &meshes);
 void mark_nodes_to_preserve(Mesh &mesh);
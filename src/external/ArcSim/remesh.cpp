@@ -34,6 +34,7 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include "referenceshape.hpp"
 #include "util.hpp"
 
+#include <algorithm>
 #include <assert.h>
 #include <cstdlib>
 #include <cstdio>
@@ -90,6 +91,48 @@ void RemeshOp::apply(Mesh &mesh) const {
 			compute_ms_data(added_faces[f]->v[i]->node);
 }
 
+void apply_all(const vector<RemeshOp> &ops, Mesh &mesh) {
+	// Same mesh changes and element order as applying the ops one by one,
+	// but a face or node shared by several ops only gets its ms data recomputed once
+	for (size_t o = 0; o < ops.size(); o++) {
+		const RemeshOp &op = ops[o];
+		remove_all(op.removed_faces, mesh);
+		remove_all(op.removed_edges, mesh);
+		remove_all(op.removed_nodes, mesh);
+		remove_all(op.removed_verts, mesh);
+		add_all(op.added_verts, mesh);
+		add_all(op.added_nodes, mesh);
+		add_all(op.added_edges, mesh);
+		add_all(op.added_faces, mesh);
+	}
+	vector<Face*> faces;
+	vector<Node*> nodes;
+	for (size_t o = 0; o < ops.size(); o++) {
+		const vector<Face*> &added = ops[o].added_faces;
+		for (size_t f = 0; f < added.size(); f++) {
+			// A face added by one op can be removed again by a later one, indices are kept valid by add and remove
+			Face *face = added[f];
+			if (face->index >= (int)mesh.faces.size() || mesh.faces[face->index] != face)
+				continue;
+			faces.push_back(face);
+			for (int i = 0; i < 3; i++)
+				nodes.push_back(face->v[i]->node);
+		}
+	}
+	// Each node's data only depends on its own adjacent faces, so the update order doesn't matter
+	sort(nodes.begin(), nodes.end());
+	nodes.erase(unique(nodes.begin(), nodes.end()), nodes.end());
+	for (size_t f = 0; f < faces.size(); f++)
+		compute_ms_data(faces[f]);
+	for (size_t n = 0; n < nodes.size(); n++)
+		compute_ms_data(nodes[n]);
+}
+
+void done_all(const vector<RemeshOp> &ops) {
+	for (size_t o = 0; o < ops.size(); o++)
+		ops[o].done();
+}
+
 void RemeshOp::done() const {
 	delete_all(removed_verts);
 	delete_all(removed_nodes);
@@ -298,7 +341,7 @@ void transferEoL(Node *n, Node *n0, Node *n1) {
 		if (n0->cornerID >= 0) {
 			for (int j = 0; j < n0->cdEdges.size(); j++) {
 				if (n1->cdEdges[0] == n0->cdEdges[j]) {
-					n->EoL = true;
+					set_EoL(n, true);
 					n->cdEdges = n1->cdEdges;
 					if(n0->EoL_state == Node::IsEOL && n1->EoL_state == Node::IsEOL) n->EoL_state = Node::NewEOLFromSplit;
 					else n->EoL_state = Node::NewEOL;
@@ -309,7 +352,7 @@ void transferEoL(Node *n, Node *n0, Node *n1) {
 		else if (n1->cornerID >= 0) {
 			for (int j = 0; j < n1->cdEdges.size(); j++) {
 				if (n0->cdEdges[0] == n1->cdEdges[j]) {
-					n->EoL = true;
+					set_EoL(n, true);
 					n->cdEdges = n0->cdEdges;
 					if (n0->EoL_state == Node::IsEOL && n1->EoL_state == Node::IsEOL) n->EoL_state = Node::NewEOLFromSplit;
 					else n->EoL_state = Node::NewEOL;
@@ -318,7 +361,7 @@ void transferEoL(Node *n, Node *n0, Node *n1) {
 			}
 		}
 		else if (n0->cdEdges[0] == n1->cdEdges[0]) {
-			n->EoL = true;
+			set_EoL(n, true);
 			n->cdEdges = n0->cdEdges;
 			if (n0->EoL_state == Node::IsEOL && n1->EoL_state == Node::IsEOL) n->EoL_state = Node::NewEOLFromSplit;
 			else n->EoL_state = Node::NewEOL;
@@ -330,8 +373,7 @@ void transferEoL(Node *n, Node *n0, Node *n1) {
 
 // The actual operations
 
-RemeshOp split_edge(Edge* edge, double d) {
-	Mesh& mesh = *edge->n[0]->mesh;
+RemeshOp build_split_edge(Edge* edge, double d) {
 	RemeshOp op;
 	Node *node0 = edge->n[0],
 		*node1 = edge->n[1],
@@ -377,9 +419,18 @@ RemeshOp split_edge(Edge* edge, double d) {
 		op.added_faces.push_back(nf0);
 		op.added_faces.push_back(nf1);
 	}
+	return op;
+}
+
+RemeshOp split_edge(Edge* edge, double d) {
+	Mesh& mesh = *edge->n[0]->mesh;
+	Node *node0 = edge->n[0], *node1 = edge->n[1];
+	RemeshOp op = build_split_edge(edge, d);
+	if (op.added_nodes.empty())
+		return op;
 	//embedding_from_plasticity(op.removed_faces);
 	op.apply(mesh);
-	node->y = (1 - d)*node0->y + d*node1->y;
+	op.added_nodes[0]->y = (1 - d)*node0->y + d*node1->y;
 	//optimize_node(node);
 	//plasticity_from_embedding(op.added_faces);
 	//local_pop_filter(op.added_faces);
@@ -449,7 +500,7 @@ RemeshOp collapse_edge(Edge* edge, int i) {
 	return op;
 }
 
-RemeshOp flip_edge(Edge* edge) {
+RemeshOp build_flip_edge(Edge* edge) {
 	RemeshOp op;
 	Vert *vert0 = edge_vert(edge, 0, 0), *vert1 = edge_vert(edge, 1, 1),
 		*vert2 = edge_opp_vert(edge, 0), *vert3 = edge_opp_vert(edge, 1);
@@ -465,6 +516,11 @@ RemeshOp flip_edge(Edge* edge) {
 	op.removed_faces.push_back(face1);
 	op.added_faces.push_back(new Face(vert0, vert3, vert2, sp, sb, face0->material, damage));
 	op.added_faces.push_back(new Face(vert1, vert2, vert3, sp, sb, face1->material, damage));
+	return op;
+}
+
+RemeshOp flip_edge(Edge* edge) {
+	RemeshOp op = build_flip_edge(edge);
 	//embedding_from_plasticity(op.removed_faces);
 	op.apply(*edge->n[0]->mesh);
 	//plasticity_from_embedding(op.added_faces);
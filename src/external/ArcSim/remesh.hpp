@@ -50,6 +50,10 @@ struct RemeshOp {
 };
 std::ostream &operator<< (std::ostream &out, const RemeshOp &op);
 
+// Applies a batch of ops in order, with a single ms data update at the end
+void apply_all(const std::vector<RemeshOp> &ops, Mesh &mesh);
+void done_all(const std::vector<RemeshOp> &ops);
+
 // These do not change the mesh directly,
 // they return a RemeshOp that you can apply() to the mesh
 
@@ -63,4 +67,10 @@ RemeshOp collapse_edge(Edge *edge, int which); // which end to delete
 
 RemeshOp flip_edge(Edge *edge);
 
+// The same ops without applying them, nothing outside the op is changed
+// so ops on edges with no face in common can be built concurrently
+RemeshOp build_split_edge(Edge *edge, double d);
+
+RemeshOp build_flip_edge(Edge *edge);
+
 #endif
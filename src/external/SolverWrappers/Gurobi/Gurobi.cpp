@@ -61,6 +61,21 @@ const VectorXd& GurobiCommon::result() const
 	return X_;
 }
 
+int GurobiCommon::variables() const
+{
+	return nrvar_;
+}
+
+int GurobiCommon::equalities() const
+{
+	return nreq_;
+}
+
+int GurobiCommon::inequalities() const
+{
+	return nrineq_;
+}
+
 GurobiCommon::WarmStatus GurobiCommon::warmStart() const
 {
 	int ws = model_.get(GRB_IntParam_MultiObjMethod);
@@ -343,10 +358,10 @@ void GurobiSparse::updateConstr(GRBConstr* constrs, const std::vector<GRBVar>& v
 			}
 		}
 
-		//Update RHSes
-		for(SparseVector<double>::InnerIterator it(b); it; ++it)
+		//Update RHSes, every row is written since the model may be reused from the last solve
+		for(int i = 0; i < len; ++i)
 		{
-			(constrs+it.row())->set(GRB_DoubleAttr_RHS, it.value());
+			(constrs+i)->set(GRB_DoubleAttr_RHS, b.coeff(i));
 		}
 	}
 }
@@ -48,6 +48,10 @@ public:
 
 	EIGEN_GUROBI_API const VectorXd& result() const;
 
+	EIGEN_GUROBI_API int variables() const;
+	EIGEN_GUROBI_API int equalities() const;
+	EIGEN_GUROBI_API int inequalities() const;
+
 	EIGEN_GUROBI_API GurobiCommon::WarmStatus warmStart() const;  
 	EIGEN_GUROBI_API void warmStart(GurobiCommon::WarmStatus warmStatus);
 
@@ -2,62 +2,39 @@
 
 #include <fstream>
 #include <iomanip>
+#include <sstream>
 
 using namespace std;
 using namespace Eigen;
 
 
-// This gets the job done for now
-// TODO:: Traverse sparse structure
+// Walks the compressed structure once, the index and value lists are built in memory
+// and written with a single stream write each, so the cost scales with the non zeros
 void mat_s2s_file(const SparseMatrix<double>& mat, const string &var_name, const string &file_name, const bool& overwrite)
 {
 	ofstream ofs;
 	if (overwrite) ofs.open(file_name, ofstream::out | ofstream::trunc);
 	else ofs.open(file_name, ofstream::out | ofstream::app);
 
-	MatrixXd dMat = MatrixXd(mat);
+	ostringstream is, js, vs;
+	vs << setprecision(16);
 
-	ofs << setprecision(20);
-
-	ofs << "i = [ ";
-
-	for (int i = 0; i < dMat.rows(); i++) {
-		for (int j = 0; j < dMat.cols(); j++) {
-			if (dMat(i, j) != 0.0) {
-				ofs << i + 1 << " ";
-			}
-		}
-	}
-
-	ofs << "]';\n";
-
-	ofs << "j = [ ";
-
-	for (int i = 0; i < dMat.rows(); i++) {
-		for (int j = 0; j < dMat.cols(); j++) {
-			if (dMat(i, j) != 0.0) {
-				ofs << j + 1 << " ";
-			}
-		}
-	}
-
-	ofs << "]';\n";
-
-	ofs << "v = [ ";
-
-	for (int i = 0; i < dMat.rows(); i++) {
-		for (int j = 0; j < dMat.cols(); j++) {
-			if (dMat(i, j) != 0.0) {
-				ofs << setprecision(16) << dMat(i, j) << " ";
-			}
+	for (int k = 0; k < mat.outerSize(); k++) {
+		for (SparseMatrix<double>::InnerIterator it(mat, k); it; ++it) {
+			if (it.value() == 0.0) continue;
+			is << it.row() + 1 << " ";
+			js << it.col() + 1 << " ";
+			vs << it.value() << " ";
 		}
 	}
 
-	ofs << "]';\n";
+	ofs << "i = [ " << is.str() << "]';\n";
+	ofs << "j = [ " << js.str() << "]';\n";
+	ofs << "v = [ " << vs.str() << "]';\n";
 
 	ofs << var_name;
 	ofs << " = sparse(i,j,v,";
-	ofs << dMat.rows() << "," << dMat.cols() << ");\n\n";
+	ofs << mat.rows() << "," << mat.cols() << ");\n\n";
 
 	ofs.close();
 }
@@ -7,12 +7,15 @@
 
 #include "Cloth.h"
 #include "Constraints.h"
+#include "Forces.h"
 #include "FixedList.h"
 #include "Obstacles.h"
 #include "Points.h"
 #include "Box.h"
 #include "Shape.h"
 #include "GeneralizedSolver.h"
+#include "QuadProgNative.h"
+#include "DebugDump.h"
 
 #include <Eigen/Core>
 
@@ -195,6 +198,9 @@ void load_solver(shared_ptr<GeneralizedSolver> gs, const Json::Value& json)
 #endif // !EOLC_GUROBI
 		gs->whichSolver = GeneralizedSolver::Gurobi;
 	}
+	else if (which == "native") {
+		gs->whichSolver = GeneralizedSolver::Native;
+	}
 	else {
 		cout << "Unrecognized solver:" << endl;
 		cout << "	\"" << which << "\"" << endl;
@@ -203,6 +209,40 @@ void load_solver(shared_ptr<GeneralizedSolver> gs, const Json::Value& json)
 	}
 }
 
+void load_fastset(shared_ptr<GeneralizedSolver> gs, const Json::Value& json)
+{
+	parse(gs->fastPath, json["enabled"], true);
+	parse(gs->benchmarkFastPath, json["benchmark"], false);
+	parse(gs->cgTolerance, json["cg_tolerance"], 1e-10);
+	string which;
+	parse(which, json["preconditioner"], string("diagonal"));
+	if (which == "diagonal") gs->cgPreconditioner = GeneralizedSolver::Diagonal;
+	else if (which == "block_jacobi") gs->cgPreconditioner = GeneralizedSolver::BlockJacobi;
+	else if (which == "ic") gs->cgPreconditioner = GeneralizedSolver::IncompleteCholesky;
+	else {
+		cout << "Unrecognized preconditioner:" << endl;
+		cout << "	\"" << which << "\"" << endl;
+		cout << "Check spelling" << endl;
+		abort();
+	}
+}
+
+void load_nativeset(shared_ptr<GeneralizedSolver> gs, const Json::Value& json)
+{
+	string which;
+	parse(which, json["linear_solver"], string("direct"));
+	if (which == "direct") gs->native->linearSolver = QuadProgNative::Direct;
+	else if (which == "cg") gs->native->linearSolver = QuadProgNative::BlockCG;
+	else {
+		cout << "Unrecognized native linear solver:" << endl;
+		cout << "	\"" << which << "\"" << endl;
+		cout << "Check spelling" << endl;
+		abort();
+	}
+	parse(gs->native->cgTolerance, json["cg_tolerance"], 1e-10);
+	parse(gs->native->verbose, json["verbose"], false);
+}
+
 void load_matset(Material& material, const Json::Value& json)
 {
 	parse(material.density, json["density"], 0.05);
@@ -222,6 +262,7 @@ void load_remeshset(Remeshing& remeshing, const Json::Value& json)
 	parse(Range(remeshing.size_min, remeshing.size_max),
 		json["size"], Vec2(-infinity, infinity), "size");
 	parse(remeshing.aspect_min, json["aspect_min"], -infinity);
+	parse(remeshing.threads, json["threads"], 1);
 }
 
 void load_fixedset(vector<shared_ptr<FixedList> > &fsv, const Json::Value& json)
@@ -305,6 +346,14 @@ void load_clothset(shared_ptr<Cloth> cloth, const Json::Value& json)
 		load_remeshset(cloth->remeshing, json);
 	}
 
+	if (json.isMember("Assembly")) {
+		parse(cloth->myForces->threads, json["Assembly"]["threads"], 1);
+		parse(cloth->myForces->deterministic, json["Assembly"]["deterministic"], false);
+	}
+
+	parse(cloth->consts->eliminateFixed, json["eliminate_fixed"], true);
+	parse(cloth->verifyTransfer, json["verify_transfer"], false);
+
 	if (json.isMember("Fixed")) {
 		load_fixedset(cloth->fs, json["Fixed"]);
 		// I don't like how I did this
@@ -382,6 +431,8 @@ void load_boxset(vector<shared_ptr<Box> > &boxes, shared_ptr<Shape> shape, const
 void load_obsset(shared_ptr<Obstacles> obs, const Json::Value& json)
 {
 	if(json.isMember("threshold")) parse(obs->cdthreshold, json["threshold"], 5e-3);
+	if (json.isMember("threads")) parse(obs->threads, json["threads"], 1);
+	if (json.isMember("jitter_seed")) parse(obs->cdseed, json["jitter_seed"], 1);
 
 	if (json.isMember("points_file")); // TODO
 
@@ -394,6 +445,28 @@ void load_obsset(shared_ptr<Obstacles> obs, const Json::Value& json)
 	obs->num_boxes = obs->boxes.size();
 }
 
+void load_dumpset(shared_ptr<DebugDump> dump, const Json::Value& json)
+{
+	parse(dump->enabled, json["enabled"], false);
+	Vector2i frames;
+	parse(frames, json["frames"], Vector2i(0, -1));
+	dump->firstFrame = frames(0);
+	dump->lastFrame = frames(1);
+	parse(dump->queueSize, json["queue"], 4);
+	parse(dump->prefix, json["prefix"], string("solver"));
+	parse(dump->timings, json["timings"], false);
+	string which;
+	parse(which, json["sink"], string("matlab"));
+	if (which == "matlab") dump->sink = DebugDump::Matlab;
+	else if (which == "binary") dump->sink = DebugDump::Binary;
+	else {
+		cout << "Unrecognized debug dump sink:" << endl;
+		cout << "	\"" << which << "\"" << endl;
+		cout << "Use either \"matlab\" or \"binary\"" << endl;
+		abort();
+	}
+}
+
 void printSimSet(shared_ptr<Scene> scene);
 
 void load_simset(shared_ptr<Scene> scene, const string &JSON_FILE)
@@ -410,6 +483,9 @@ void load_simset(shared_ptr<Scene> scene, const string &JSON_FILE)
 	file.close();
 
 	if (json.isMember("solver")) load_solver(scene->GS, json["solver"]);
+	if (json.isMember("FastSolve")) load_fastset(scene->GS, json["FastSolve"]);
+	if (json.isMember("NativeSolver")) load_nativeset(scene->GS, json["NativeSolver"]);
+	parse(scene->GS->logTiming, json["solve_timing"], false);
 
 	parse(scene->h, json["timestep"], 0.005);
 	parse(scene->grav, json["gravity"], Vector3d(0.0, 0.0, -9.8));
@@ -421,6 +497,8 @@ void load_simset(shared_ptr<Scene> scene, const string &JSON_FILE)
 
 	if (json.isMember("Obstacles")) load_obsset(scene->obs, json["Obstacles"]);
 
+	if (json.isMember("DebugDump")) load_dumpset(scene->cloth->dump, json["DebugDump"]);
+
 	printSimSet(scene);
 }
 
@@ -435,6 +513,18 @@ void printSimSet(shared_ptr<Scene> scene)
 	cout << "	Timestep: " << scene->h << endl;
 	cout << "	REMESH: " << printSimBool(scene->REMESHon) << endl;
 	cout << "	EOL: " << printSimBool(scene->EOLon) << endl;
+	cout << "	FastSolve: " << printSimBool(scene->GS->fastPath) << endl;
+	if (scene->GS->fastPath) {
+		cout << "		benchmark: " << printSimBool(scene->GS->benchmarkFastPath) << endl;
+		cout << "		cg_tolerance: " << scene->GS->cgTolerance << endl;
+		cout << "		preconditioner: " << GeneralizedSolver::preconditionerName(scene->GS->cgPreconditioner) << endl;
+	}
+	cout << "	solve_timing: " << printSimBool(scene->GS->logTiming) << endl;
+	if (scene->GS->whichSolver == GeneralizedSolver::Native) {
+		cout << "	NativeSolver: " << endl;
+		cout << "		linear_solver: " << (scene->GS->native->linearSolver == QuadProgNative::BlockCG ? "cg" : "direct") << endl;
+		cout << "		verbose: " << printSimBool(scene->GS->native->verbose) << endl;
+	}
 	cout << "	Cloth:" << endl;
 	cout << "		cloth_obj: " << "" << endl;
 	cout << "		Material: " << endl;
@@ -449,11 +539,25 @@ void printSimSet(shared_ptr<Scene> scene)
 	cout << "			refine_velocity: " << scene->cloth->remeshing.refine_velocity << endl;
 	cout << "			size: [" << scene->cloth->remeshing.size_min << ", " << scene->cloth->remeshing.size_max << "]" << endl;
 	cout << "			aspect_min: " << scene->cloth->remeshing.aspect_min << endl;
+	cout << "			threads: " << scene->cloth->remeshing.threads << endl;
+	cout << "		Assembly: " << endl;
+	cout << "			threads: " << scene->cloth->myForces->threads << endl;
+	cout << "			deterministic: " << printSimBool(scene->cloth->myForces->deterministic) << endl;
+	cout << "		eliminate_fixed: " << printSimBool(scene->cloth->consts->eliminateFixed) << endl;
+	cout << "		verify_transfer: " << printSimBool(scene->cloth->verifyTransfer) << endl;
 	cout << "	Obstacles:" << endl;
 	cout << "		threshold: " << scene->obs->cdthreshold << endl;
+	cout << "		threads: " << scene->obs->threads << endl;
+	cout << "		jitter_seed: " << scene->obs->cdseed << endl;
 	//cout << "		points_file: " << "" << endl;
 	cout << "		total_points: " << scene->obs->points->num_points << endl;
 	//cout << "		box_file: " << "" << endl;
 	cout << "		total_boxes" << scene->obs->num_boxes << endl;
+	cout << "	DebugDump: " << printSimBool(scene->cloth->dump->enabled) << endl;
+	if (scene->cloth->dump->enabled) {
+		cout << "		frames: [" << scene->cloth->dump->firstFrame << ", " << scene->cloth->dump->lastFrame << "]" << endl;
+		cout << "		sink: " << (scene->cloth->dump->sink == DebugDump::Binary ? "binary" : "matlab") << endl;
+		cout << "		prefix: " << scene->cloth->dump->prefix << endl;
+	}
 
 }
\ No newline at end of file